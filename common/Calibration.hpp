@@ -0,0 +1,70 @@
+// Copyright 2011-2021 Tyler Gilbert and Stratify Labs, Inc; see LICENSE.md
+
+#ifndef CALIBRATION_HPP
+#define CALIBRATION_HPP
+
+#include <printer/Printer.hpp>
+#include <test/Test.hpp>
+#include <var/StackString.hpp>
+
+// Finds how many runs of a benchmark fill a measurement window.
+//
+// Starting at 1000 runs, measure(run_count) is called and the count is grown
+// until one measurement takes at least minimum_us microseconds. Each round is
+// printed in a "calibration" object. measure() returns the duration of the
+// runs in microseconds.
+template <typename Measure>
+u32 calibrate_run_count(u32 minimum_us, u32 maximum_run_count,
+                        Measure measure) {
+  auto &output = test::Test::printer();
+  printer::Printer::Object calibration_object(output, "calibration");
+  output.key("minDuration", var::NumberString(minimum_us, "%d us"));
+
+  u32 run_count = 1000;
+  for (u32 round = 1;; round++) {
+    const u32 duration_us = measure(run_count);
+    output.key(var::NumberString(round, "round%ld"),
+               var::NumberString(run_count, "%ld runs ") |
+                   var::NumberString(duration_us, "%ld us"));
+
+    if (duration_us >= minimum_us || run_count == maximum_run_count) {
+      return run_count;
+    }
+
+    // aim past the window so the next round is likely the last, grow by
+    // at most 10x while the duration is too short to extrapolate from
+    u64 next = u64(run_count) * 10;
+    if (duration_us > 0) {
+      const u64 estimate = u64(run_count) * minimum_us * 6 / 5 / duration_us;
+      next = estimate < next ? estimate : next;
+    }
+    if (next <= run_count) {
+      next = run_count + 1;
+    }
+    run_count = next > maximum_run_count ? maximum_run_count : u32(next);
+  }
+}
+
+// Returns explicit_count when it is not zero, otherwise calibrates with
+// calibrate_run_count(). Either way the count is clamped to maximum_run_count.
+//
+// The first result is kept for the rest of the process so repeated runs,
+// each with a new test object, measure the same amount of work. It is kept
+// per Measure type, and every lambda has its own type, so each benchmark
+// that passes its own lambda calibrates once.
+template <typename Measure>
+u32 cached_run_count(u32 explicit_count, u32 minimum_us,
+                     u32 maximum_run_count, Measure measure) {
+  static u32 run_count = 0;
+  if (run_count == 0) {
+    run_count = explicit_count ? explicit_count
+                               : calibrate_run_count(
+                                     minimum_us, maximum_run_count, measure);
+    if (run_count > maximum_run_count) {
+      run_count = maximum_run_count;
+    }
+  }
+  return run_count;
+}
+
+#endif // CALIBRATION_HPP
@@ -0,0 +1,14 @@
+// Copyright 2011-2021 Tyler Gilbert and Stratify Labs, Inc; see LICENSE.md
+
+#include <sys.hpp>
+#include <var.hpp>
+
+#include "CliOption.hpp"
+
+u32 parse_u32_option(const sys::Cli &cli, var::StringView name,
+                     var::StringView help, u32 value) {
+  const auto option = cli.get_option(name, help);
+  return option.is_empty()
+             ? value
+             : option.to_unsigned_long(var::StringView::Base::auto_);
+}
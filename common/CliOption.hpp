@@ -0,0 +1,14 @@
+// Copyright 2011-2021 Tyler Gilbert and Stratify Labs, Inc; see LICENSE.md
+
+#ifndef CLIOPTION_HPP
+#define CLIOPTION_HPP
+
+#include <sys/Cli.hpp>
+#include <var/StringView.hpp>
+
+// Returns --name=<value> as a number (0x for hex), or value when the option
+// is not given. help is what --help prints for the option.
+u32 parse_u32_option(const sys::Cli &cli, var::StringView name,
+                     var::StringView help, u32 value);
+
+#endif // CLIOPTION_HPP
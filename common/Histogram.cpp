@@ -0,0 +1,144 @@
+// Copyright 2011-2021 Tyler Gilbert and Stratify Labs, Inc; see LICENSE.md
+
+#include <printer.hpp>
+#include <var.hpp>
+
+#include "Histogram.hpp"
+
+Histogram &Histogram::add(u32 value) {
+  m_buckets[bucket_index(value)]++;
+  if (m_count == 0 || value < m_minimum) {
+    m_minimum = value;
+  }
+  if (value > m_maximum) {
+    m_maximum = value;
+  }
+  m_sum += value;
+  m_count++;
+  return *this;
+}
+
+Histogram &Histogram::merge(const Histogram &other) {
+  if (other.m_count == 0) {
+    return *this;
+  }
+  for (u32 i = 0; i < bucket_count; i++) {
+    m_buckets[i] += other.m_buckets[i];
+  }
+  if (m_count == 0 || other.m_minimum < m_minimum) {
+    m_minimum = other.m_minimum;
+  }
+  if (other.m_maximum > m_maximum) {
+    m_maximum = other.m_maximum;
+  }
+  m_sum += other.m_sum;
+  m_count += other.m_count;
+  return *this;
+}
+
+Histogram &Histogram::reset() {
+  for (auto &bucket : m_buckets) {
+    bucket = 0;
+  }
+  m_count = 0;
+  m_minimum = 0;
+  m_maximum = 0;
+  m_sum = 0;
+  return *this;
+}
+
+u32 Histogram::percentile(float percent) const {
+  if (m_count == 0) {
+    return 0;
+  }
+
+  // rank of the sample (1 based) that is at the percentile
+  u32 rank = u32(percent * m_count / 100.0f + 0.999f);
+  if (rank == 0) {
+    rank = 1;
+  }
+  if (rank > m_count) {
+    rank = m_count;
+  }
+
+  u32 total = 0;
+  for (u32 i = 0; i < bucket_count; i++) {
+    total += m_buckets[i];
+    if (total >= rank) {
+      const u32 upper = bucket_upper_bound(i);
+      if (upper > m_maximum) {
+        return m_maximum;
+      }
+      return upper < m_minimum ? m_minimum : upper;
+    }
+  }
+  return m_maximum;
+}
+
+const Histogram &Histogram::print(printer::Printer &printer,
+                                  var::StringView name,
+                                  var::StringView unit) const {
+  printer::Printer::Object histogram_object(printer, name);
+  printer.key("unit", unit)
+      .key("samples", NumberString(count()))
+      .key("min", NumberString(minimum()))
+      .key("mean", NumberString(mean()))
+      .key("p50", NumberString(percentile(50.0f)))
+      .key("p90", NumberString(percentile(90.0f)))
+      .key("p99", NumberString(percentile(99.0f)))
+      .key("max", NumberString(maximum()));
+
+  // collapse the sub-buckets to power-of-two bins to keep the output short
+  printer::Printer::Object bins_object(printer, "histogram");
+  u32 bin = 0;
+  u32 bin_count = 0;
+  const auto flush_bin = [&]() {
+    if (bin_count) {
+      printer.key(bin < 32 ? NumberString(u32(1) << bin, "<%lu")
+                           : NumberString(u32(1) << 31, ">=%lu"),
+                  NumberString(bin_count));
+    }
+  };
+
+  for (u32 i = 0; i < bucket_count; i++) {
+    const u32 lower = bucket_lower_bound(i);
+    const u32 lower_bin = lower ? 32 - __builtin_clz(lower) : 0;
+    if (lower_bin != bin) {
+      flush_bin();
+      bin = lower_bin;
+      bin_count = 0;
+    }
+    bin_count += m_buckets[i];
+  }
+  flush_bin();
+
+  return *this;
+}
+
+u32 Histogram::bucket_index(u32 value) {
+  if (value < linear_count) {
+    return value;
+  }
+  const u32 msb = 31 - __builtin_clz(value);
+  const u32 sub_bucket =
+      (value >> (msb - sub_bucket_bits)) & (sub_bucket_count - 1);
+  return linear_count + (msb - 4) * sub_bucket_count + sub_bucket;
+}
+
+u32 Histogram::bucket_lower_bound(u32 index) {
+  if (index < linear_count) {
+    return index;
+  }
+  const u32 offset = index - linear_count;
+  const u32 msb = offset / sub_bucket_count + 4;
+  const u32 sub_bucket = offset % sub_bucket_count;
+  return (sub_bucket_count + sub_bucket) << (msb - sub_bucket_bits);
+}
+
+u32 Histogram::bucket_upper_bound(u32 index) {
+  if (index < linear_count) {
+    return index;
+  }
+  const u32 msb = (index - linear_count) / sub_bucket_count + 4;
+  return bucket_lower_bound(index) + (u32(1) << (msb - sub_bucket_bits)) - 1;
+}
@@ -0,0 +1,51 @@
+// Copyright 2011-2021 Tyler Gilbert and Stratify Labs, Inc; see LICENSE.md
+
+#ifndef HISTOGRAM_HPP
+#define HISTOGRAM_HPP
+
+#include <printer/Printer.hpp>
+#include <var/StringView.hpp>
+
+// Fixed memory histogram for latency samples.
+//
+// Values below 16 get their own bucket. Larger values are split into
+// power-of-two ranges with 8 linear sub-buckets each so percentiles are
+// accurate to within 12.5% no matter how many samples are added.
+class Histogram {
+public:
+  Histogram &add(u32 value);
+  Histogram &merge(const Histogram &other);
+  Histogram &reset();
+
+  u32 count() const { return m_count; }
+  u32 minimum() const { return m_count ? m_minimum : 0; }
+  u32 maximum() const { return m_maximum; }
+  u32 mean() const { return m_count ? u32(m_sum / m_count) : 0; }
+  u64 sum() const { return m_sum; }
+
+  // percent is 0.0 to 100.0, returns the upper bound of the bucket holding
+  // the percentile (clamped to the measured min/max)
+  u32 percentile(float percent) const;
+
+  const Histogram &print(printer::Printer &printer, var::StringView name,
+                         var::StringView unit) const;
+
+private:
+  static constexpr u32 linear_count = 16;
+  static constexpr u32 sub_bucket_bits = 3;
+  static constexpr u32 sub_bucket_count = 1 << sub_bucket_bits;
+  static constexpr u32 bucket_count =
+      linear_count + (32 - 4) * sub_bucket_count;
+
+  u32 m_buckets[bucket_count] = {};
+  u32 m_count = 0;
+  u32 m_minimum = 0;
+  u32 m_maximum = 0;
+  u64 m_sum = 0;
+
+  static u32 bucket_index(u32 value);
+  static u32 bucket_lower_bound(u32 index);
+  static u32 bucket_upper_bound(u32 index);
+};
+
+#endif // HISTOGRAM_HPP
@@ -0,0 +1,31 @@
+// Copyright 2011-2021 Tyler Gilbert and Stratify Labs, Inc; see LICENSE.md
+
+#ifndef PSEUDORANDOM_HPP
+#define PSEUDORANDOM_HPP
+
+#include <sdk/types.h>
+
+// xorshift32 generator
+//
+// Cheap enough to call inside a timed loop and gives the same sequence on
+// every target so a seed reproduces a workload exactly.
+class PseudoRandom {
+public:
+  explicit PseudoRandom(u32 seed = 1) : m_state(seed ? seed : 1) {}
+
+  u32 next() {
+    u32 x = m_state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    return m_state = x;
+  }
+
+  // uniform value from 0 to limit - 1
+  u32 next(u32 limit) { return u32((u64(next()) * limit) >> 32); }
+
+private:
+  u32 m_state;
+};
+
+#endif // PSEUDORANDOM_HPP
@@ -0,0 +1,102 @@
+// Copyright 2011-2021 Tyler Gilbert and Stratify Labs, Inc; see LICENSE.md
+
+#include <printer.hpp>
+#include <var.hpp>
+
+#include "CliOption.hpp"
+#include "Repeat.hpp"
+#include "ResultArchive.hpp"
+#include "Statistics.hpp"
+
+Repeat::Repeat(const sys::Cli &cli) {
+  m_repeat_count = parse_u32_option(
+      cli, "repeat", "number of times to run performance cases (default 1)",
+      m_repeat_count);
+  if (m_repeat_count == 0) {
+    m_repeat_count = 1;
+  }
+
+  m_warmup_count = parse_u32_option(
+      cli, "warmup", "unrecorded runs before --repeat starts (default 0)",
+      m_warmup_count);
+}
+
+bool Repeat::is_repeated(test::Test::ExecuteFlags execute_flags) const {
+  const u32 performance = u32(test::Test::ExecuteFlags::performance);
+  return (u32(execute_flags) & performance) &&
+         (m_repeat_count > 1 || m_warmup_count > 0);
+}
+
+bool Repeat::has_other_cases(test::Test::ExecuteFlags execute_flags) {
+  const u32 performance = u32(test::Test::ExecuteFlags::performance);
+  const u32 case_flags = u32(test::Test::ExecuteFlags::all);
+  return u32(execute_flags) & case_flags & ~performance;
+}
+
+// application specific bits (such as test selectors) are kept in both the
+// other and the performance flags
+test::Test::ExecuteFlags
+Repeat::other_flags(test::Test::ExecuteFlags execute_flags) {
+  const u32 performance = u32(test::Test::ExecuteFlags::performance);
+  return test::Test::ExecuteFlags(u32(execute_flags) & ~performance);
+}
+
+test::Test::ExecuteFlags
+Repeat::performance_flags(test::Test::ExecuteFlags execute_flags) {
+  const u32 performance = u32(test::Test::ExecuteFlags::performance);
+  const u32 case_flags = u32(test::Test::ExecuteFlags::all);
+  return test::Test::ExecuteFlags(u32(execute_flags) &
+                                  ~(case_flags & ~performance));
+}
+
+void Repeat::open_run(var::StringView kind, u32 index) {
+  test::Test::printer().open_object(kind | NumberString(index));
+}
+
+void Repeat::close_run() { test::Test::printer().close_object(); }
+
+void Repeat::print_summary(u32 first_record) const {
+  struct Entry {
+    var::String key;
+    Statistics statistics;
+  };
+
+  auto &output = test::Test::printer();
+  printer::Printer::Object repeat_object(output, "repeat");
+  output.key("warmup", NumberString(m_warmup_count))
+      .key("repeat", NumberString(m_repeat_count));
+
+  var::Vector<Entry> entries;
+  for (u32 i = first_record; i < ResultArchive::record_count(); i++) {
+    const auto &record = ResultArchive::record_at(i);
+    Entry *entry = nullptr;
+    for (auto &existing : entries) {
+      if (existing.key == record.key) {
+        entry = &existing;
+        break;
+      }
+    }
+    if (entry == nullptr) {
+      entries.push_back(Entry{record.key, Statistics()});
+      entry = &entries.at(entries.count() - 1);
+    }
+    entry->statistics.add(record.value);
+  }
+
+  for (const auto &entry : entries) {
+    const auto &statistics = entry.statistics;
+    const double mean = statistics.mean();
+    const double interval = statistics.confidence_interval_95();
+
+    printer::Printer::Object entry_object(output, entry.key);
+    output.key("samples", NumberString(statistics.count()))
+        .key("min", NumberString(statistics.minimum(), "%g"))
+        .key("median", NumberString(statistics.median(), "%g"))
+        .key("mean", NumberString(mean, "%g"))
+        .key("stddev", NumberString(statistics.standard_deviation(), "%g"))
+        .key("ci95", NumberString(interval, "%g"))
+        .key("ci95Percent",
+             NumberString(mean != 0.0 ? interval * 100.0 / mean : 0.0,
+                          "%0.1f%%"));
+  }
+}
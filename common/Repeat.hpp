@@ -0,0 +1,83 @@
+// Copyright 2011-2021 Tyler Gilbert and Stratify Labs, Inc; see LICENSE.md
+
+#ifndef REPEAT_HPP
+#define REPEAT_HPP
+
+#include <sys/Cli.hpp>
+#include <test/Test.hpp>
+
+#include "ResultArchive.hpp"
+
+// Runs the performance case of a test more than once.
+//
+// --warmup=M runs the performance case M times and throws the results away,
+// then --repeat=N runs it N times. All other cases run once.
+//
+// The test is passed as a factory, a callable that returns a new test:
+//
+// repeat.execute([&] { return FileTest(path, options); }, flags);
+//
+// Each run gets its own test object so no member state carries over, and
+// its output is printed in its own object (warmup0, run0, run1, ...).
+//
+// The summary covers the values the case passes to ResultArchive::record(),
+// reported per metric as min, median, mean, standard deviation and the 95%
+// confidence interval of the mean. Printed keys that are not archived are
+// only in the output of each run. Each repetition is also archived so
+// --compare has more than one sample to work with.
+class Repeat {
+public:
+  explicit Repeat(const sys::Cli &cli);
+
+  template <typename Factory>
+  const Repeat &execute(Factory factory,
+                        test::Test::ExecuteFlags execute_flags) const {
+    if (is_repeated(execute_flags) == false) {
+      factory().execute(execute_flags);
+      return *this;
+    }
+
+    if (has_other_cases(execute_flags)) {
+      factory().execute(other_flags(execute_flags));
+    }
+
+    const auto flags = performance_flags(execute_flags);
+    for (u32 i = 0; i < m_warmup_count; i++) {
+      const u32 first_record = ResultArchive::record_count();
+      open_run("warmup", i);
+      factory().execute(flags);
+      close_run();
+      ResultArchive::discard_from(first_record);
+    }
+
+    const u32 first_record = ResultArchive::record_count();
+    for (u32 i = 0; i < m_repeat_count; i++) {
+      open_run("run", i);
+      factory().execute(flags);
+      close_run();
+    }
+
+    print_summary(first_record);
+    return *this;
+  }
+
+  u32 repeat_count() const { return m_repeat_count; }
+  u32 warmup_count() const { return m_warmup_count; }
+
+private:
+  u32 m_repeat_count = 1;
+  u32 m_warmup_count = 0;
+
+  bool is_repeated(test::Test::ExecuteFlags execute_flags) const;
+  static bool has_other_cases(test::Test::ExecuteFlags execute_flags);
+  static test::Test::ExecuteFlags
+  other_flags(test::Test::ExecuteFlags execute_flags);
+  static test::Test::ExecuteFlags
+  performance_flags(test::Test::ExecuteFlags execute_flags);
+
+  static void open_run(var::StringView kind, u32 index);
+  static void close_run();
+  void print_summary(u32 first_record) const;
+};
+
+#endif // REPEAT_HPP
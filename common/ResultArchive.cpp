@@ -0,0 +1,295 @@
+// Copyright 2011-2021 Tyler Gilbert and Stratify Labs, Inc; see LICENSE.md
+
+#include <cstdlib>
+#include <cstring>
+
+#include <chrono.hpp>
+#include <fs.hpp>
+#include <printer.hpp>
+#include <test/Test.hpp>
+#include <var.hpp>
+
+#include "ResultArchive.hpp"
+#include "Statistics.hpp"
+
+ResultArchive *ResultArchive::m_active = nullptr;
+
+ResultArchive::ResultArchive(const sys::Cli &cli, var::StringView name,
+                             var::StringView version,
+                             var::StringView git_hash)
+    : m_name(name), m_version(version), m_git_hash(git_hash) {
+
+  const auto archive = cli.get_option(
+      "archive", "append results to this file (--archive alone uses "
+                 "/home/testsuite.csv)");
+  const auto compare = cli.get_option(
+      "compare", "compare <baseline>[:<candidate>] git hashes in the archive");
+  const auto threshold = cli.get_option(
+      "threshold", "smallest change in percent --compare reports (default 2)");
+
+  if (archive.is_empty() == false) {
+    m_path = var::String(archive == "true" ? var::StringView(default_path())
+                                           : archive);
+  }
+
+  if (compare.is_empty() == false) {
+    if (m_path.is_empty()) {
+      m_path = var::String(default_path());
+    }
+    const size_t colon = compare.find(":");
+    if (colon == var::StringView::npos) {
+      m_baseline = var::String(compare);
+      m_candidate = var::String(git_hash);
+    } else {
+      m_baseline = var::String(var::StringView(compare.data(), colon));
+      m_candidate = var::String(var::StringView(
+          compare.data() + colon + 1, compare.length() - colon - 1));
+    }
+  }
+
+  if (threshold.is_empty() == false) {
+    m_threshold = threshold.to_float();
+  }
+
+  m_run = ClockTime::get_system_time().seconds();
+}
+
+void ResultArchive::record(var::StringView key, double value,
+                           IsHigherBetter is_higher_better) {
+  if (m_active == nullptr) {
+    return;
+  }
+  m_active->m_records.push_back(Record{var::String(key), value,
+                                       is_higher_better});
+}
+
+u32 ResultArchive::record_count() {
+  return m_active ? m_active->m_records.count() : 0;
+}
+
+const ResultArchive::Record &ResultArchive::record_at(u32 index) {
+  return m_active->m_records.at(index);
+}
+
+void ResultArchive::discard_from(u32 first) {
+  if (m_active && first < m_active->m_records.count()) {
+    m_active->m_records.resize(first);
+  }
+}
+
+void ResultArchive::append() const {
+  if (m_records.count() == 0) {
+    return;
+  }
+
+  api::ErrorScope error_scope;
+  if (FileSystem().exists(m_path) == false) {
+    File(File::IsOverwrite::yes, m_path)
+        .write("name,gitHash,version,run,key,value,isHigherBetter\n");
+  }
+
+  File f(m_path, OpenMode::append_write_only());
+  for (const auto &record : m_records) {
+    f.write(m_name)
+        .write(",")
+        .write(m_git_hash)
+        .write(",")
+        .write(m_version)
+        .write(",")
+        .write(NumberString(m_run))
+        .write(",")
+        .write(record.key)
+        .write(",")
+        .write(NumberString(record.value, "%g"))
+        .write(record.is_higher_better == IsHigherBetter::yes ? ",1\n"
+                                                               : ",0\n");
+  }
+
+  printer::Printer::Object archive_object(test::Test::printer(), "archive");
+  test::Test::printer()
+      .key("path", m_path)
+      .key("records", NumberString(m_records.count()))
+      .key_bool("saved", is_success());
+}
+
+void ResultArchive::compare() const {
+  struct Entry {
+    var::String key;
+    IsHigherBetter is_higher_better;
+    Statistics baseline;
+    Statistics candidate;
+  };
+
+  var::Vector<Entry> entries;
+  auto &output = test::Test::printer();
+  printer::Printer::Object compare_object(output, "compare");
+  output.key("baseline", m_baseline)
+      .key("candidate", m_candidate)
+      .key("threshold", NumberString(m_threshold, "%0.1f%%"));
+
+  // runs are matched by git hash prefix, a short prefix or one that also
+  // matches the other side would mix the runs of unrelated builds
+  constexpr size_t minimum_prefix_length = 7;
+  if (m_baseline.length() < minimum_prefix_length ||
+      m_candidate.length() < minimum_prefix_length) {
+    output.key("error", "git hash prefixes need at least " |
+                            NumberString(u32(minimum_prefix_length)) |
+                            " characters");
+    return;
+  }
+
+  const size_t common_length = m_baseline.length() < m_candidate.length()
+                                   ? m_baseline.length()
+                                   : m_candidate.length();
+  if (strncmp(m_baseline.cstring(), m_candidate.cstring(), common_length) ==
+      0) {
+    output.key("error", "baseline and candidate prefixes overlap");
+    return;
+  }
+
+  const auto process_line = [&](char *line) {
+    // name,gitHash,version,run,key,value,isHigherBetter
+    constexpr size_t field_count = 7;
+    char *fields[field_count] = {};
+    size_t count = 0;
+    for (char *cursor = line; count < field_count; count++) {
+      fields[count] = cursor;
+      cursor = strchr(cursor, ',');
+      if (cursor == nullptr) {
+        count++;
+        break;
+      }
+      *cursor++ = 0;
+    }
+
+    if (count != field_count || strcmp(fields[0], m_name.cstring()) != 0) {
+      return;
+    }
+
+    const bool is_baseline = strncmp(fields[1], m_baseline.cstring(),
+                                     m_baseline.length()) == 0;
+    const bool is_candidate = strncmp(fields[1], m_candidate.cstring(),
+                                      m_candidate.length()) == 0;
+    if (is_baseline == false && is_candidate == false) {
+      return;
+    }
+
+    Entry *entry = nullptr;
+    for (auto &existing : entries) {
+      if (strcmp(existing.key.cstring(), fields[4]) == 0) {
+        entry = &existing;
+        break;
+      }
+    }
+    if (entry == nullptr) {
+      entries.push_back(Entry{var::String(fields[4]),
+                              fields[6][0] == '1' ? IsHigherBetter::yes
+                                                  : IsHigherBetter::no,
+                              Statistics(), Statistics()});
+      entry = &entries.at(entries.count() - 1);
+    }
+
+    const double value = strtod(fields[5], nullptr);
+    if (is_baseline) {
+      entry->baseline.add(value);
+    }
+    if (is_candidate) {
+      entry->candidate.add(value);
+    }
+  };
+
+  {
+    api::ErrorScope error_scope;
+    File f(m_path);
+    if (is_error()) {
+      output.key("error", "failed to open " | m_path);
+      return;
+    }
+
+    // read in chunks, lines longer than the buffer are skipped
+    char chunk[64];
+    char line[256];
+    size_t line_length = 0;
+    bool is_overflow = false;
+    int bytes_read;
+    while ((bytes_read = f.read(var::View(chunk, sizeof(chunk)))
+                             .return_value()) > 0) {
+      for (int i = 0; i < bytes_read; i++) {
+        const char c = chunk[i];
+        if (c == '\n' || c == '\r') {
+          if (line_length && is_overflow == false) {
+            line[line_length] = 0;
+            process_line(line);
+          }
+          line_length = 0;
+          is_overflow = false;
+        } else if (line_length < sizeof(line) - 1) {
+          line[line_length++] = c;
+        } else {
+          is_overflow = true;
+        }
+      }
+    }
+    if (line_length && is_overflow == false) {
+      line[line_length] = 0;
+      process_line(line);
+    }
+  }
+
+  u32 regression_count = 0;
+  for (const auto &entry : entries) {
+    if (entry.baseline.count() == 0 || entry.candidate.count() == 0) {
+      continue;
+    }
+
+    const double baseline = entry.baseline.mean();
+    const double candidate = entry.candidate.mean();
+    const double change =
+        baseline != 0.0 ? (candidate - baseline) * 100.0 / baseline : 0.0;
+    const bool is_worse = entry.is_higher_better == IsHigherBetter::yes
+                              ? change < 0.0
+                              : change > 0.0;
+    const auto significance =
+        Statistics::compare(entry.baseline, entry.candidate);
+
+    // with a single sample per side only the threshold can be applied
+    const char *result = "same";
+    if ((change < 0.0 ? -change : change) >= m_threshold) {
+      if (significance == Statistics::Significance::same) {
+        result = "noise";
+      } else {
+        result = is_worse ? "regression" : "improvement";
+        regression_count += is_worse ? 1 : 0;
+      }
+    }
+
+    printer::Printer::Object entry_object(output, entry.key);
+    output.key("baseline", NumberString(baseline, "%g"))
+        .key("candidate", NumberString(candidate, "%g"))
+        .key("change", NumberString(change, "%+0.1f%%"))
+        .key("samples", NumberString(entry.baseline.count()) | "/" |
+                            NumberString(entry.candidate.count()))
+        .key_bool("tTest",
+                  significance != Statistics::Significance::unknown)
+        .key("result", result);
+  }
+
+  output.key("regressions", NumberString(regression_count));
+}
+
+ResultArchive::Scope::Scope(const sys::Cli &cli, var::StringView name,
+                            var::StringView version, var::StringView git_hash)
+    : m_archive(cli, name, version, git_hash) {
+  m_active = &m_archive;
+}
+
+ResultArchive::Scope::~Scope() {
+  m_active = nullptr;
+  if (m_archive.m_path.is_empty()) {
+    return;
+  }
+  m_archive.append();
+  if (m_archive.m_baseline.is_empty() == false) {
+    m_archive.compare();
+  }
+}
@@ -0,0 +1,85 @@
+// Copyright 2011-2021 Tyler Gilbert and Stratify Labs, Inc; see LICENSE.md
+
+#ifndef RESULTARCHIVE_HPP
+#define RESULTARCHIVE_HPP
+
+#include <sys/Cli.hpp>
+#include <var/String.hpp>
+#include <var/StringView.hpp>
+#include <var/Vector.hpp>
+
+// Keeps benchmark results from run to run.
+//
+// Performance cases call ResultArchive::record() for the numbers they print.
+// When the application is started with --archive, the recorded values are
+// appended to a CSV file along with the application name, version and git
+// hash. --compare=<baseline>[:<candidate>] then compares the runs of two git
+// hashes (the candidate defaults to the current build) and flags significant
+// regressions.
+//
+// Each line of the archive is:
+//
+// name,gitHash,version,run,key,value,isHigherBetter
+class ResultArchive {
+public:
+  enum class IsHigherBetter { no, yes };
+
+  class Scope;
+
+  struct Record {
+    var::String key;
+    double value;
+    IsHigherBetter is_higher_better;
+  };
+
+  // does nothing unless a Scope is active
+  static void record(var::StringView key, double value,
+                     IsHigherBetter is_higher_better = IsHigherBetter::yes);
+
+  // records of the active Scope, zero when there is none
+  static u32 record_count();
+  // index must be less than record_count()
+  static const Record &record_at(u32 index);
+  // drops the records from first onward (used to discard warmup runs)
+  static void discard_from(u32 first);
+
+  static constexpr const char *default_path() {
+    return "/home/testsuite.csv";
+  }
+
+private:
+  var::String m_path;
+  var::String m_name;
+  var::String m_version;
+  var::String m_git_hash;
+  var::String m_baseline;
+  var::String m_candidate;
+  double m_threshold = 2.0;
+  u32 m_run = 0;
+  var::Vector<Record> m_records;
+
+  static ResultArchive *m_active;
+
+  ResultArchive(const sys::Cli &cli, var::StringView name,
+                var::StringView version, var::StringView git_hash);
+
+  void append() const;
+  void compare() const;
+};
+
+// created in main() after Test::Scope so the comparison is printed with the
+// test printer, the archive is updated when the scope is destroyed
+class ResultArchive::Scope {
+public:
+  Scope(const sys::Cli &cli, var::StringView name, var::StringView version,
+        var::StringView git_hash);
+  ~Scope();
+
+  Scope(const Scope &) = delete;
+  Scope &operator=(const Scope &) = delete;
+
+private:
+  ResultArchive m_archive;
+};
+
+#endif // RESULTARCHIVE_HPP
@@ -0,0 +1,28 @@
+// Copyright 2011-2021 Tyler Gilbert and Stratify Labs, Inc; see LICENSE.md
+
+#ifndef SCALING_HPP
+#define SCALING_HPP
+
+#include <sdk/types.h>
+
+// Throughput of a multi-threaded run relative to the single-thread run.
+//
+// Threads are run 1, 2, 4, ... and the 1 thread result is kept as the
+// baseline. 100% means adding threads added no throughput, N x 100% is
+// ideal scaling for N threads. 0 until the baseline is known.
+class Scaling {
+public:
+  u32 percent(u32 thread_count, u32 throughput) {
+    if (thread_count == 1) {
+      m_single_thread_throughput = throughput;
+    }
+    return m_single_thread_throughput
+             ? u32(u64(throughput) * 100 / m_single_thread_throughput)
+             : 0;
+  }
+
+private:
+  u32 m_single_thread_throughput = 0;
+};
+
+#endif // SCALING_HPP
@@ -0,0 +1,133 @@
+// Copyright 2011-2021 Tyler Gilbert and Stratify Labs, Inc; see LICENSE.md
+
+#include <cmath>
+
+#include <var.hpp>
+
+#include "Statistics.hpp"
+
+Statistics &Statistics::add(double value) {
+  m_samples.push_back(value);
+  return *this;
+}
+
+double Statistics::minimum() const {
+  double result = count() ? m_samples.at(0) : 0.0;
+  for (const auto value : m_samples) {
+    result = value < result ? value : result;
+  }
+  return result;
+}
+
+double Statistics::maximum() const {
+  double result = count() ? m_samples.at(0) : 0.0;
+  for (const auto value : m_samples) {
+    result = value > result ? value : result;
+  }
+  return result;
+}
+
+double Statistics::mean() const {
+  if (count() == 0) {
+    return 0.0;
+  }
+  double sum = 0.0;
+  for (const auto value : m_samples) {
+    sum += value;
+  }
+  return sum / count();
+}
+
+double Statistics::median() const {
+  if (count() == 0) {
+    return 0.0;
+  }
+
+  // insertion sort a copy, sample counts are small
+  var::Vector<double> sorted;
+  for (const auto value : m_samples) {
+    sorted.push_back(value);
+    for (u32 i = sorted.count() - 1; i > 0 && sorted.at(i - 1) > sorted.at(i);
+         i--) {
+      const double swap = sorted.at(i);
+      sorted.at(i) = sorted.at(i - 1);
+      sorted.at(i - 1) = swap;
+    }
+  }
+
+  const u32 middle = count() / 2;
+  return count() % 2 ? sorted.at(middle)
+                     : (sorted.at(middle - 1) + sorted.at(middle)) / 2.0;
+}
+
+double Statistics::variance() const {
+  if (count() < 2) {
+    return 0.0;
+  }
+  const double average = mean();
+  double sum = 0.0;
+  for (const auto value : m_samples) {
+    sum += (value - average) * (value - average);
+  }
+  return sum / (count() - 1);
+}
+
+double Statistics::standard_deviation() const { return sqrt(variance()); }
+
+double Statistics::confidence_interval_95() const {
+  if (count() < 2) {
+    return 0.0;
+  }
+  return t_critical_95(count() - 1) * standard_deviation() / sqrt(count());
+}
+
+double Statistics::t_critical_95(u32 degrees_of_freedom) {
+  static constexpr double table[] = {
+      12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262, 2.228,
+      2.201,  2.179, 2.160, 2.145, 2.131, 2.120, 2.110, 2.101, 2.093, 2.086,
+      2.080,  2.074, 2.069, 2.064, 2.060, 2.056, 2.052, 2.048, 2.045, 2.042};
+  constexpr u32 table_count = sizeof(table) / sizeof(table[0]);
+
+  if (degrees_of_freedom == 0) {
+    return table[0];
+  }
+  if (degrees_of_freedom <= table_count) {
+    return table[degrees_of_freedom - 1];
+  }
+  if (degrees_of_freedom <= 40) {
+    return 2.021;
+  }
+  if (degrees_of_freedom <= 60) {
+    return 2.000;
+  }
+  if (degrees_of_freedom <= 120) {
+    return 1.980;
+  }
+  return 1.960;
+}
+
+Statistics::Significance Statistics::compare(const Statistics &a,
+                                             const Statistics &b) {
+  if (a.count() < 2 || b.count() < 2) {
+    return Significance::unknown;
+  }
+
+  const double a_error = a.variance() / a.count();
+  const double b_error = b.variance() / b.count();
+  const double error = a_error + b_error;
+  const double difference = b.mean() - a.mean();
+
+  if (error == 0.0) {
+    return difference == 0.0 ? Significance::same : Significance::different;
+  }
+
+  // Welch-Satterthwaite degrees of freedom
+  const double degrees_of_freedom =
+      error * error / (a_error * a_error / (a.count() - 1) +
+                       b_error * b_error / (b.count() - 1));
+  const double t = difference / sqrt(error);
+
+  return fabs(t) > t_critical_95(u32(degrees_of_freedom))
+             ? Significance::different
+             : Significance::same;
+}
@@ -0,0 +1,37 @@
+// Copyright 2011-2021 Tyler Gilbert and Stratify Labs, Inc; see LICENSE.md
+
+#ifndef STATISTICS_HPP
+#define STATISTICS_HPP
+
+#include <var/Vector.hpp>
+
+// Summary statistics for a small set of samples such as the repeated
+// results of one benchmark metric
+class Statistics {
+public:
+  Statistics &add(double value);
+
+  u32 count() const { return m_samples.count(); }
+  double minimum() const;
+  double maximum() const;
+  double mean() const;
+  double median() const;
+  // sample variance (divides by count - 1)
+  double variance() const;
+  double standard_deviation() const;
+  // half width of the 95% confidence interval of the mean
+  double confidence_interval_95() const;
+
+  // two-sided 95% critical value of Student's t distribution
+  static double t_critical_95(u32 degrees_of_freedom);
+
+  enum class Significance { unknown, same, different };
+
+  // Welch's t-test for a difference in means
+  static Significance compare(const Statistics &a, const Statistics &b);
+
+private:
+  var::Vector<double> m_samples;
+};
+
+#endif // STATISTICS_HPP
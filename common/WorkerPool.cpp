@@ -0,0 +1,60 @@
+// Copyright 2011-2021 Tyler Gilbert and Stratify Labs, Inc; see LICENSE.md
+
+#include <thread.hpp>
+#include <var.hpp>
+
+#include "WorkerPool.hpp"
+
+WorkerPool::WorkerPool(u32 capacity) {
+  m_entries.resize(capacity);
+  m_start_mutex.lock();
+}
+
+WorkerPool::~WorkerPool() {
+  if (m_is_started == false) {
+    m_is_cancelled = true;
+    start();
+  }
+  if (m_is_joined == false) {
+    join();
+  }
+}
+
+WorkerPool &WorkerPool::add(void *argument, Function function) {
+  API_ASSERT(m_count < m_entries.count());
+  Entry &entry = m_entries.at(m_count++);
+  entry.pool = this;
+  entry.argument = argument;
+  entry.function = function;
+  entry.thread = thread::Thread(
+      thread::Thread::Attributes().set_joinable(),
+      thread::Thread::Construct().set_argument(&entry).set_function(run));
+  return *this;
+}
+
+WorkerPool &WorkerPool::start() {
+  m_is_started = true;
+  m_start_mutex.unlock();
+  return *this;
+}
+
+bool WorkerPool::join() {
+  m_is_joined = true;
+  bool result = true;
+  for (u32 i = 0; i < m_count; i++) {
+    if (m_entries.at(i).thread.join().is_error()) {
+      result = false;
+    }
+  }
+  return result;
+}
+
+void *WorkerPool::run(void *args) {
+  auto *entry = reinterpret_cast<Entry *>(args);
+  WorkerPool *pool = entry->pool;
+  { thread::Mutex::Scope start(pool->m_start_mutex); }
+  if (pool->m_is_cancelled) {
+    return nullptr;
+  }
+  return entry->function(entry->argument);
+}
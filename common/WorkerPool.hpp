@@ -0,0 +1,63 @@
+// Copyright 2011-2021 Tyler Gilbert and Stratify Labs, Inc; see LICENSE.md
+
+#ifndef WORKERPOOL_HPP
+#define WORKERPOOL_HPP
+
+#include <thread/Mutex.hpp>
+#include <thread/Thread.hpp>
+#include <var/Vector.hpp>
+
+// Starts a group of threads at the same moment.
+//
+// Each add() creates a joinable thread that blocks until start() is called,
+// so creating the threads is not part of what the caller measures:
+//
+// WorkerPool pool(workers.count());
+// for (auto &worker : workers) {
+//   pool.add(&worker, [](void *args) -> void * { ... });
+// }
+// ClockTimer timer(ClockTimer::IsRunning::yes);
+// pool.start();
+// TEST_EXPECT(pool.join());
+//
+// capacity is the largest number of threads that will be added. If the pool
+// goes out of scope before start() (a failed TEST_ASSERT returns early), the
+// threads that were created exit without calling their function. The
+// destructor joins any thread that has not been joined.
+class WorkerPool {
+public:
+  using Function = void *(*)(void *);
+
+  explicit WorkerPool(u32 capacity);
+  ~WorkerPool();
+
+  WorkerPool(const WorkerPool &) = delete;
+  WorkerPool &operator=(const WorkerPool &) = delete;
+
+  WorkerPool &add(void *argument, Function function);
+  WorkerPool &start();
+  // false if any thread could not be joined
+  bool join();
+
+  u32 count() const { return m_count; }
+
+private:
+  struct Entry {
+    thread::Thread thread;
+    WorkerPool *pool = nullptr;
+    void *argument = nullptr;
+    Function function = nullptr;
+  };
+
+  thread::Mutex m_start_mutex;
+  // sized once, each thread keeps a pointer to its entry
+  var::Vector<Entry> m_entries;
+  u32 m_count = 0;
+  bool m_is_started = false;
+  bool m_is_cancelled = false;
+  bool m_is_joined = false;
+
+  static void *run(void *args);
+};
+
+#endif // WORKERPOOL_HPP
@@ -0,0 +1,23 @@
+# Sources shared by the testsuite applications
+#
+# include(${CMAKE_CURRENT_SOURCE_DIR}/../common/common.cmake)
+# then add ${COMMON_SOURCES} to the target and ${COMMON_DIRECTORY} to the
+# target include directories
+
+set(COMMON_DIRECTORY ${CMAKE_CURRENT_LIST_DIR})
+set(COMMON_SOURCES
+	${COMMON_DIRECTORY}/Calibration.hpp
+	${COMMON_DIRECTORY}/CliOption.cpp
+	${COMMON_DIRECTORY}/CliOption.hpp
+	${COMMON_DIRECTORY}/Histogram.cpp
+	${COMMON_DIRECTORY}/Histogram.hpp
+	${COMMON_DIRECTORY}/PseudoRandom.hpp
+	${COMMON_DIRECTORY}/Repeat.cpp
+	${COMMON_DIRECTORY}/Repeat.hpp
+	${COMMON_DIRECTORY}/Scaling.hpp
+	${COMMON_DIRECTORY}/ResultArchive.cpp
+	${COMMON_DIRECTORY}/ResultArchive.hpp
+	${COMMON_DIRECTORY}/Statistics.cpp
+	${COMMON_DIRECTORY}/Statistics.hpp
+	${COMMON_DIRECTORY}/WorkerPool.cpp
+	${COMMON_DIRECTORY}/WorkerPool.hpp)
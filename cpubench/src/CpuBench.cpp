@@ -0,0 +1,193 @@
+#include <chrono.hpp>
+#include <var.hpp>
+
+#include "Calibration.hpp"
+#include "CliOption.hpp"
+#include "CpuBench.hpp"
+#include "ResultArchive.hpp"
+#include "Statistics.hpp"
+
+using namespace chrono;
+using namespace sys;
+using namespace test;
+using namespace var;
+
+namespace {
+// results of each kernel and variant for CPUBENCH_DEFAULT_SEED
+constexpr u16 expected_results[CPUBENCH_KERNEL_COUNT]
+                              [CPUBENCH_VARIANT_COUNT] = {
+  {0xa57d, 0x3c61, 0x8764, 0x3dbe, 0xe14f, 0x3fdf, 0x84da, 0x3e00},
+  {0xd018, 0x3955, 0x058f, 0x8a4a, 0x1a28, 0xe10c, 0xbc30, 0xdf64},
+  {0xfe5a, 0x300e, 0xe90f, 0x51ef, 0x18f7, 0x83da, 0x5adb, 0xe23b},
+  {0xca49, 0x0113, 0x5cfc, 0x97a6, 0xe722, 0x2c78, 0x7197, 0xbacd}};
+} // namespace
+
+CpuBench::Options::Options(const Cli &cli) {
+  set_run_count(parse_u32_option(
+    cli,
+    "runs",
+    "fixed number of runs, calibrates to --minDuration when not given",
+    run_count()));
+  set_minimum_duration(parse_u32_option(
+    cli,
+    "minDuration",
+    "shortest calibrated measurement in milliseconds (default 2000)",
+    minimum_duration()));
+  set_sample_count(parse_u32_option(
+    cli,
+    "samples",
+    "number of measurements used for the error bounds (default 3)",
+    sample_count()));
+  set_seed(parse_u32_option(
+    cli,
+    "seed",
+    "seed for the input data, results are only checked with the default",
+    seed()));
+}
+
+CpuBench::CpuBench(const StringView name, const Options &options)
+  : Test(name), m_options(options) {}
+
+bool CpuBench::execute_class_performance_case() {
+  TEST_ASSERT(m_options.sample_count() > 0);
+  TEST_ASSERT(execute_validation());
+
+  const auto measure_all = [this](u32 run_count) {
+    u32 duration_us = 0;
+    for (u32 i = 0; i < CPUBENCH_KERNEL_COUNT; i++) {
+      duration_us += measure(i, run_count);
+    }
+    return duration_us;
+  };
+
+  m_run_count = cached_run_count(
+    m_options.run_count(),
+    m_options.minimum_duration() * 1000,
+    maximum_run_count(),
+    measure_all);
+
+  Statistics statistics;
+  u64 kernel_us[CPUBENCH_KERNEL_COUNT] = {};
+  u64 total_us = 0;
+  for (u32 sample = 0; sample < m_options.sample_count(); sample++) {
+    u32 duration_us = 0;
+    for (u32 i = 0; i < CPUBENCH_KERNEL_COUNT; i++) {
+      const u32 elapsed_us = measure(i, m_run_count);
+      kernel_us[i] += elapsed_us;
+      duration_us += elapsed_us;
+    }
+    total_us += duration_us;
+    // one iteration runs every kernel once
+    statistics.add(double(m_run_count) * 1000000.0 / duration_us);
+  }
+
+  const u32 sample_count = m_options.sample_count();
+  const double error = statistics.confidence_interval_95();
+  printer()
+    .key("runs", NumberString(m_run_count))
+    .key("samples", NumberString(statistics.count()))
+    .key("duration", NumberString(u32(total_us / sample_count), "%d us"))
+    .key("score", NumberString(u32(statistics.mean() + 0.5)))
+    .key("scoreMin", NumberString(statistics.minimum(), "%0.2f"))
+    .key("scoreMax", NumberString(statistics.maximum(), "%0.2f"))
+    .key("scoreError", NumberString(error, "%0.2f"))
+    .key(
+      "scoreErrorPercent",
+      NumberString(
+        statistics.mean() != 0.0 ? error * 100.0 / statistics.mean() : 0.0,
+        "%0.2f%%"));
+
+  for (u32 i = 0; i < CPUBENCH_KERNEL_COUNT; i++) {
+    printer::Printer::Object kernel_object(printer(), kernel_name(i));
+    printer()
+      .key("duration", NumberString(u32(kernel_us[i] / sample_count), "%d us"))
+      .key(
+        "share",
+        NumberString(
+          total_us ? double(kernel_us[i]) * 100.0 / total_us : 0.0,
+          "%0.1f%%"));
+    ResultArchive::record(
+      "cpubench." | StringView(kernel_name(i)) | ".duration",
+      kernel_us[i] / sample_count,
+      ResultArchive::IsHigherBetter::no);
+  }
+
+  // every timed iteration is checked against the validation run
+  printer().key("errors", NumberString(m_error_count));
+  TEST_EXPECT(m_error_count == 0);
+
+  ResultArchive::record("cpubench.score", statistics.mean());
+  return case_result();
+}
+
+bool CpuBench::execute_validation() {
+  Case cg(this, "validation");
+
+  const u16 seed = u16(m_options.seed());
+  cpubench_list_init(seed);
+  cpubench_matrix_init(seed);
+  cpubench_state_init(seed);
+  cpubench_crc_init(seed);
+
+  const bool is_default_seed = seed == CPUBENCH_DEFAULT_SEED;
+  printer().key("seed", NumberString(seed, "0x%04X"));
+
+  u16 checksum = 0;
+  for (u32 i = 0; i < CPUBENCH_KERNEL_COUNT; i++) {
+    u16 kernel_checksum = 0;
+    bool is_valid = true;
+    for (u32 variant = 0; variant < CPUBENCH_VARIANT_COUNT; variant++) {
+      const u16 result = kernel(i)(variant);
+      m_reference[i][variant] = result;
+      kernel_checksum = cpubench_crc16(kernel_checksum, u8(result));
+      kernel_checksum = cpubench_crc16(kernel_checksum, u8(result >> 8));
+      if (is_default_seed && result != expected_results[i][variant]) {
+        is_valid = false;
+      }
+    }
+    checksum = cpubench_crc16(checksum, u8(kernel_checksum));
+    checksum = cpubench_crc16(checksum, u8(kernel_checksum >> 8));
+
+    printer::Printer::Object kernel_object(printer(), kernel_name(i));
+    printer().key("checksum", NumberString(kernel_checksum, "0x%04X"));
+    if (is_default_seed) {
+      printer().key_bool("valid", is_valid);
+      TEST_EXPECT(is_valid);
+    }
+  }
+
+  printer().key("checksum", NumberString(checksum, "0x%04X"));
+  if (is_default_seed == false) {
+    printer().key("valid", "unknown (not the default seed)");
+  }
+
+  return case_result();
+}
+
+u32 CpuBench::measure(u32 index, u32 run_count) {
+  const Kernel function = kernel(index);
+  const u16 *reference = m_reference[index];
+  u32 error_count = 0;
+
+  ClockTimer timer(ClockTimer::IsRunning::yes);
+  for (u32 i = 0; i < run_count; i++) {
+    const u32 variant = i & (CPUBENCH_VARIANT_COUNT - 1);
+    error_count += function(variant) != reference[variant];
+  }
+  timer.stop();
+
+  m_error_count += error_count;
+  return timer.microseconds() ? timer.microseconds() : 1;
+}
+
+CpuBench::Kernel CpuBench::kernel(u32 index) {
+  static constexpr Kernel kernels[CPUBENCH_KERNEL_COUNT]
+    = {cpubench_list, cpubench_matrix, cpubench_state, cpubench_crc};
+  return kernels[index];
+}
+
+const char *CpuBench::kernel_name(u32 index) {
+  static constexpr const char *names[CPUBENCH_KERNEL_COUNT]
+    = {"list", "matrix", "state", "crc"};
+  return names[index];
+}
@@ -0,0 +1,47 @@
+#ifndef CPUBENCH_HPP
+#define CPUBENCH_HPP
+
+#include <sys/Cli.hpp>
+#include <test/Test.hpp>
+
+#include "cpubench.h"
+
+class CpuBench : public test::Test {
+public:
+  class Options {
+  public:
+    Options() = default;
+    explicit Options(const sys::Cli &cli);
+
+    // a run count of zero grows the count until one measurement takes at
+    // least the minimum duration
+    API_AF(Options, u32, run_count, 0);
+    API_AF(Options, u32, minimum_duration, 2000);
+    API_AF(Options, u32, sample_count, 3);
+
+    // results are only checked against known values with the default seed
+    API_AF(Options, u32, seed, CPUBENCH_DEFAULT_SEED);
+  };
+
+  CpuBench(const var::StringView name, const Options &options = Options());
+
+  bool execute_class_performance_case();
+
+private:
+  using Kernel = u16 (*)(unsigned variant);
+
+  Options m_options;
+  u32 m_run_count = 0;
+  u32 m_error_count = 0;
+  u16 m_reference[CPUBENCH_KERNEL_COUNT][CPUBENCH_VARIANT_COUNT] = {};
+
+  bool execute_validation();
+  u32 measure(u32 kernel, u32 run_count);
+
+  static Kernel kernel(u32 index);
+  static const char *kernel_name(u32 index);
+
+  static constexpr u32 maximum_run_count() { return 0x7fffffff; }
+};
+
+#endif // CPUBENCH_HPP
@@ -0,0 +1,69 @@
+/*
+ * CPU benchmark kernels
+ *
+ * Four kernels that exercise what Dhrystone doesn't: pointer chasing
+ * (linked list find, reverse and merge sort), integer matrix multiply, a
+ * branchy state machine (number parser) and a bitwise CRC-32. Each kernel
+ * works on data generated from a seed at run time so the compiler can't
+ * precompute the results, and returns a CRC-16 of its results so every
+ * iteration can be validated.
+ *
+ * Iterations cycle through CPUBENCH_VARIANT_COUNT variants of the input.
+ */
+
+#ifndef CPUBENCH_H
+#define CPUBENCH_H
+
+#include <stdint.h>
+
+#if defined __cplusplus
+extern "C" {
+#endif
+
+#define CPUBENCH_VARIANT_COUNT 8
+#define CPUBENCH_DEFAULT_SEED 0x3415
+
+enum
+{
+  CPUBENCH_LIST,
+  CPUBENCH_MATRIX,
+  CPUBENCH_STATE,
+  CPUBENCH_CRC,
+  CPUBENCH_KERNEL_COUNT
+};
+
+void cpubench_list_init (uint16_t seed);
+uint16_t cpubench_list (unsigned variant);
+
+void cpubench_matrix_init (uint16_t seed);
+uint16_t cpubench_matrix (unsigned variant);
+
+void cpubench_state_init (uint16_t seed);
+uint16_t cpubench_state (unsigned variant);
+
+void cpubench_crc_init (uint16_t seed);
+uint16_t cpubench_crc (unsigned variant);
+
+/* CRC-16/CCITT of one more byte, used to fold the kernel results */
+uint16_t cpubench_crc16 (uint16_t crc, uint8_t data);
+
+/* linear congruential generator for the input data */
+static inline uint32_t cpubench_random (uint32_t *state)
+{
+  *state = *state * 1103515245UL + 12345UL;
+  return *state >> 16;
+}
+
+static inline uint16_t cpubench_crc16_u32 (uint16_t crc, uint32_t value)
+{
+  crc = cpubench_crc16 (crc, (uint8_t) value);
+  crc = cpubench_crc16 (crc, (uint8_t) (value >> 8));
+  crc = cpubench_crc16 (crc, (uint8_t) (value >> 16));
+  return cpubench_crc16 (crc, (uint8_t) (value >> 24));
+}
+
+#if defined __cplusplus
+}
+#endif
+
+#endif /* CPUBENCH_H */
@@ -0,0 +1,42 @@
+/*
+ * CRC kernel: bitwise (table free) CRC-32 over a block of data
+ */
+
+#include "cpubench.h"
+
+#define CRC_SIZE 512
+
+static uint8_t crc_data [CRC_SIZE];
+
+void cpubench_crc_init (uint16_t seed)
+{
+  uint32_t state = seed;
+  int i;
+  for (i = 0; i < CRC_SIZE; i++)
+    crc_data [i] = (uint8_t) cpubench_random (&state);
+}
+
+uint16_t cpubench_crc (unsigned variant)
+{
+  uint32_t crc = ~(uint32_t) variant;
+  int i;
+  int bit;
+
+  for (i = 0; i < CRC_SIZE; i++)
+  {
+    crc ^= crc_data [i];
+    for (bit = 0; bit < 8; bit++)
+      crc = (crc >> 1) ^ (0xEDB88320UL & (0 - (crc & 1)));
+  }
+  crc = ~crc;
+  return (uint16_t) (crc ^ (crc >> 16));
+}
+
+uint16_t cpubench_crc16 (uint16_t crc, uint8_t data)
+{
+  int bit;
+  crc ^= (uint16_t) data << 8;
+  for (bit = 0; bit < 8; bit++)
+    crc = crc & 0x8000 ? (uint16_t) ((crc << 1) ^ 0x1021) : (uint16_t) (crc << 1);
+  return crc;
+}
@@ -0,0 +1,148 @@
+/*
+ * List kernel: find, reverse and merge sort a singly linked list
+ */
+
+#include <stddef.h>
+
+#include "cpubench.h"
+
+#define LIST_COUNT 64
+
+typedef struct list_node
+{
+  struct list_node *next;
+  uint16_t index;
+  uint16_t value;
+} list_node;
+
+typedef int (*list_compare) (const list_node *a, const list_node *b);
+
+static list_node list_pool [LIST_COUNT];
+static list_node *list_head;
+
+void cpubench_list_init (uint16_t seed)
+{
+  uint32_t state = seed;
+  int i;
+  for (i = 0; i < LIST_COUNT; i++)
+  {
+    list_pool [i].index = (uint16_t) i;
+    list_pool [i].value = (uint16_t) (cpubench_random (&state) & 0x3ff);
+    list_pool [i].next = i + 1 < LIST_COUNT ? &list_pool [i + 1] : NULL;
+  }
+  list_head = &list_pool [0];
+}
+
+static int compare_value (const list_node *a, const list_node *b)
+{
+  if (a->value != b->value)
+    return a->value - b->value;
+  return a->index - b->index;
+}
+
+static int compare_index (const list_node *a, const list_node *b)
+{
+  return a->index - b->index;
+}
+
+static list_node *list_reverse (list_node *list)
+{
+  list_node *result = NULL;
+  while (list != NULL)
+  {
+    list_node *next = list->next;
+    list->next = result;
+    result = list;
+    list = next;
+  }
+  return result;
+}
+
+/* bottom up merge sort, merges runs of 1, 2, 4, ... nodes without recursion */
+static list_node *list_sort (list_node *list, list_compare compare)
+{
+  int run = 1;
+
+  for (;;)
+  {
+    list_node *p = list;
+    list_node *tail = NULL;
+    int merges = 0;
+
+    list = NULL;
+    while (p != NULL)
+    {
+      list_node *q = p;
+      int p_size = 0;
+      int q_size = run;
+
+      merges++;
+      while (p_size < run && q != NULL)
+      {
+        p_size++;
+        q = q->next;
+      }
+
+      while (p_size > 0 || (q_size > 0 && q != NULL))
+      {
+        list_node *node;
+        if (p_size == 0)
+        {
+          node = q;
+          q = q->next;
+          q_size--;
+        }
+        else if (q_size == 0 || q == NULL || compare (p, q) <= 0)
+        {
+          node = p;
+          p = p->next;
+          p_size--;
+        }
+        else
+        {
+          node = q;
+          q = q->next;
+          q_size--;
+        }
+
+        if (tail != NULL)
+          tail->next = node;
+        else
+          list = node;
+        tail = node;
+      }
+      p = q;
+    }
+    tail->next = NULL;
+
+    if (merges <= 1)
+      return list;
+    run *= 2;
+  }
+}
+
+uint16_t cpubench_list (unsigned variant)
+{
+  const uint16_t target = (uint16_t) ((variant * 7) % LIST_COUNT);
+  uint16_t crc = 0;
+  uint16_t position = 0;
+  list_node *node;
+
+  list_head = list_reverse (list_head);
+  for (node = list_head; node != NULL; node = node->next, position++)
+    if (node->index == target)
+      break;
+  crc = cpubench_crc16 (crc, (uint8_t) position);
+
+  list_head = list_sort (list_head, compare_value);
+  for (node = list_head; node != NULL; node = node->next)
+  {
+    const uint16_t value = (uint16_t) (node->value ^ variant);
+    crc = cpubench_crc16 (crc, (uint8_t) value);
+    crc = cpubench_crc16 (crc, (uint8_t) (value >> 8));
+  }
+
+  /* back to the original order for the next iteration */
+  list_head = list_sort (list_head, compare_index);
+  return crc;
+}
@@ -0,0 +1,35 @@
+#include <sys/Cli.hpp>
+#include <test/Test.hpp>
+
+#include "sl_config.h"
+
+#include "CpuBench.hpp"
+#include "Repeat.hpp"
+#include "ResultArchive.hpp"
+
+using namespace sys;
+using namespace test;
+using namespace printer;
+
+int main(int argc, char *argv[]) {
+  Cli cli(argc, argv);
+
+  {
+    auto scope = Test::Scope<Printer>(Test::Initialize()
+                                        .set_git_hash(SOS_GIT_HASH)
+                                        .set_name(SL_CONFIG_NAME)
+                                        .set_version(SL_CONFIG_VERSION_STRING));
+    ResultArchive::Scope archive_scope(
+      cli,
+      SL_CONFIG_NAME,
+      SL_CONFIG_VERSION_STRING,
+      SOS_GIT_HASH);
+
+    const CpuBench::Options options(cli);
+    Repeat(cli).execute(
+      [&] { return CpuBench("cpubench", options); },
+      Test::ExecuteFlags::performance);
+  }
+
+  return 0;
+}
@@ -0,0 +1,48 @@
+/*
+ * Matrix kernel: 16 x 16 integer matrix multiply
+ */
+
+#include "cpubench.h"
+
+#define MATRIX_N 16
+
+static int16_t matrix_a [MATRIX_N][MATRIX_N];
+static int16_t matrix_b [MATRIX_N][MATRIX_N];
+static int32_t matrix_c [MATRIX_N][MATRIX_N];
+
+void cpubench_matrix_init (uint16_t seed)
+{
+  uint32_t state = seed;
+  int i;
+  int j;
+  for (i = 0; i < MATRIX_N; i++)
+    for (j = 0; j < MATRIX_N; j++)
+    {
+      matrix_a [i][j] = (int16_t) ((cpubench_random (&state) & 0xff) - 128);
+      matrix_b [i][j] = (int16_t) ((cpubench_random (&state) & 0xff) - 128);
+    }
+}
+
+uint16_t cpubench_matrix (unsigned variant)
+{
+  /* |sum| <= 16 * (128 + 8) * 128 so it can't overflow */
+  const int16_t offset = (int16_t) variant;
+  uint16_t crc = 0;
+  int i;
+  int j;
+  int k;
+
+  for (i = 0; i < MATRIX_N; i++)
+    for (j = 0; j < MATRIX_N; j++)
+    {
+      int32_t sum = 0;
+      for (k = 0; k < MATRIX_N; k++)
+        sum += (int32_t) (matrix_a [i][k] + offset) * matrix_b [k][j];
+      matrix_c [i][j] = sum;
+    }
+
+  for (i = 0; i < MATRIX_N; i++)
+    for (j = 0; j < MATRIX_N; j++)
+      crc = cpubench_crc16_u32 (crc, (uint32_t) matrix_c [i][j]);
+  return crc;
+}
@@ -0,0 +1,21 @@
+/* Do not modifiy this file.
+ * It was generated using the sl command line tool
+ * Change the settings using the tool then build again using sl
+ */
+
+#ifndef SL_CONFIG_H_
+#define SL_CONFIG_H_
+
+#define SL_CONFIG_VERSION_STRING "0.1"
+#define SL_CONFIG_VERSION_BCD 0x01
+#define SL_CONFIG_DOCUMENT_ID ""
+#define SL_CONFIG_TEAM_ID ""
+#define SL_CONFIG_NAME "cpubench"
+#define SL_CONFIG_TYPE "app"
+#define SL_CONFIG_PERMISSIONS "public"
+#define SL_CONFIG_HARDWARE_ID_STRING ""
+
+//Thread stack sizes
+
+#endif
+
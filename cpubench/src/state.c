@@ -0,0 +1,126 @@
+/*
+ * State machine kernel: classifies comma separated tokens as integers,
+ * decimals, scientific notation or invalid one character at a time
+ */
+
+#include "cpubench.h"
+
+#define STATE_SIZE 256
+
+typedef enum
+{
+  STATE_START,
+  STATE_SIGN,
+  STATE_INTEGER,
+  STATE_POINT,
+  STATE_DECIMAL,
+  STATE_EXPONENT,
+  STATE_EXPONENT_SIGN,
+  STATE_SCIENTIFIC,
+  STATE_INVALID,
+  STATE_COUNT
+} state_t;
+
+static char state_input [STATE_SIZE];
+
+void cpubench_state_init (uint16_t seed)
+{
+  static const char *const tokens [] =
+  {
+    "5012", "1234", "-874", "+122", "35.54", "-.123", "0.5", "-110.700",
+    "5.500e+3", "-.123e-2", "-87e+832", "+0.6e-12", "T0.3e-1F", "-T.T++Tq",
+    "1T3.4e4z", "34.0e-T^"
+  };
+  uint32_t random_state = seed;
+  int length = 0;
+
+  while (length < STATE_SIZE - 1)
+  {
+    const char *token = tokens [cpubench_random (&random_state) & 0xf];
+    while (*token && length < STATE_SIZE - 2)
+      state_input [length++] = *token++;
+    state_input [length++] = ',';
+  }
+  state_input [length] = 0;
+}
+
+static int is_digit (char c)
+{
+  return c >= '0' && c <= '9';
+}
+
+static state_t state_next (state_t state, char c)
+{
+  switch (state)
+  {
+    case STATE_START:
+      if (is_digit (c))
+        return STATE_INTEGER;
+      if (c == '+' || c == '-')
+        return STATE_SIGN;
+      if (c == '.')
+        return STATE_POINT;
+      return STATE_INVALID;
+    case STATE_SIGN:
+      if (is_digit (c))
+        return STATE_INTEGER;
+      if (c == '.')
+        return STATE_POINT;
+      return STATE_INVALID;
+    case STATE_INTEGER:
+      if (is_digit (c))
+        return STATE_INTEGER;
+      if (c == '.')
+        return STATE_DECIMAL;
+      if (c == 'e' || c == 'E')
+        return STATE_EXPONENT;
+      return STATE_INVALID;
+    case STATE_POINT:
+      return is_digit (c) ? STATE_DECIMAL : STATE_INVALID;
+    case STATE_DECIMAL:
+      if (is_digit (c))
+        return STATE_DECIMAL;
+      if (c == 'e' || c == 'E')
+        return STATE_EXPONENT;
+      return STATE_INVALID;
+    case STATE_EXPONENT:
+      if (c == '+' || c == '-')
+        return STATE_EXPONENT_SIGN;
+      return is_digit (c) ? STATE_SCIENTIFIC : STATE_INVALID;
+    case STATE_EXPONENT_SIGN:
+    case STATE_SCIENTIFIC:
+      return is_digit (c) ? STATE_SCIENTIFIC : STATE_INVALID;
+    default:
+      return STATE_INVALID;
+  }
+}
+
+uint16_t cpubench_state (unsigned variant)
+{
+  uint32_t final_count [STATE_COUNT] = {0};
+  uint32_t transition_count = 0;
+  state_t state = STATE_START;
+  const char *cursor = state_input + variant;
+  uint16_t crc = cpubench_crc16 (0, (uint8_t) variant);
+  int i;
+
+  /* starting part way through the first token is one more test case */
+  for (; *cursor; cursor++)
+  {
+    if (*cursor == ',')
+    {
+      final_count [state]++;
+      state = STATE_START;
+    }
+    else
+    {
+      const state_t next = state_next (state, *cursor);
+      transition_count += next != state;
+      state = next;
+    }
+  }
+
+  for (i = 0; i < STATE_COUNT; i++)
+    crc = cpubench_crc16_u32 (crc, final_count [i]);
+  return cpubench_crc16_u32 (crc, transition_count);
+}
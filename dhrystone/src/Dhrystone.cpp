@@ -0,0 +1,227 @@
+#include <chrono.hpp>
+#include <thread.hpp>
+#include <var.hpp>
+
+#include "Calibration.hpp"
+#include "CliOption.hpp"
+#include "Dhrystone.hpp"
+#include "ResultArchive.hpp"
+#include "Statistics.hpp"
+#include "WorkerPool.hpp"
+#include "dhry.h"
+
+using namespace chrono;
+using namespace sys;
+using namespace test;
+using namespace thread;
+using namespace var;
+
+Dhrystone::Options::Options(const Cli &cli) {
+  set_run_count(parse_u32_option(
+    cli,
+    "runs",
+    "fixed number of runs, calibrates to --minDuration when not given",
+    run_count()));
+  set_minimum_duration(parse_u32_option(
+    cli,
+    "minDuration",
+    "shortest calibrated measurement in milliseconds (default 2000)",
+    minimum_duration()));
+  set_sample_count(parse_u32_option(
+    cli,
+    "samples",
+    "number of measurements used for the error bounds (default 3)",
+    sample_count()));
+  set_maximum_thread_count(parse_u32_option(
+    cli,
+    "maxThreads",
+    "run up to this many instances in parallel threads (default 1)",
+    maximum_thread_count()));
+}
+
+Dhrystone::Dhrystone(const StringView name, const Options &options)
+  : Test(name), m_options(options) {}
+
+bool Dhrystone::execute_class_performance_case() {
+  TEST_ASSERT(m_options.sample_count() > 0);
+
+  m_run_count = cached_run_count(
+    m_options.run_count(),
+    m_options.minimum_duration() * 1000,
+    maximum_run_count(),
+    [this](u32 run_count) { return measure(run_count); });
+  TEST_ASSERT(m_failure_count == 0);
+
+  dhry_profile_reset();
+  Statistics statistics;
+  u64 total_us = 0;
+  for (u32 i = 0; i < m_options.sample_count(); i++) {
+    const u32 duration_us = measure(m_run_count);
+    total_us += duration_us;
+    statistics.add(double(m_run_count) * 1000000.0 / (duration_us * 1757.0));
+  }
+  TEST_ASSERT(m_failure_count == 0);
+
+  // 1000 seconds for NUMBER_OF_RUNS is the baseline -- divide this by the
+  // execution time to get score -- smaller time is a higher score
+  const u64 mean_us = total_us / m_options.sample_count();
+  const u32 score =
+    u32(u64(m_run_count) * (1000000000UL / NUMBER_OF_RUNS) / mean_us);
+  const u32 dmips = u32(statistics.mean() + 0.5);
+  const double error = statistics.confidence_interval_95();
+
+  printer()
+    .key("runs", NumberString(m_run_count))
+    .key("samples", NumberString(statistics.count()))
+    .key("duration", NumberString(u32(mean_us), "%d us"))
+    .key("score", NumberString(score))
+    .key("dmips", NumberString(dmips))
+    .key("dmipsMin", NumberString(statistics.minimum(), "%0.2f"))
+    .key("dmipsMax", NumberString(statistics.maximum(), "%0.2f"))
+    .key("dmipsError", NumberString(error, "%0.2f"))
+    .key(
+      "dmipsErrorPercent",
+      NumberString(
+        statistics.mean() != 0.0 ? error * 100.0 / statistics.mean() : 0.0,
+        "%0.2f%%"));
+
+  ResultArchive::record("dhrystone.score", score);
+  ResultArchive::record("dhrystone.dmips", statistics.mean());
+  // scaled to NUMBER_OF_RUNS so runs with different calibrated counts compare
+  ResultArchive::record(
+    "dhrystone.duration",
+    double(mean_us) * NUMBER_OF_RUNS / m_run_count,
+    ResultArchive::IsHigherBetter::no);
+
+  if (DHRY_PROFILE) {
+    print_profile();
+  }
+
+  // without thread local storage the instances would share (and corrupt)
+  // the benchmark globals, asking for threads fails the case rather than
+  // reporting numbers that mean nothing
+  const u32 maximum_thread_count = m_options.maximum_thread_count();
+  if (maximum_thread_count > 1 && DHRY_IS_REENTRANT == 0) {
+    printer().key(
+      "error",
+      "--maxThreads needs thread local storage, this build has none");
+    TEST_ASSERT(DHRY_IS_REENTRANT);
+  }
+
+  if (maximum_thread_count > 1) {
+    for (u32 thread_count = 1; thread_count <= maximum_thread_count;
+         thread_count *= 2) {
+      TEST_ASSERT(execute_thread_performance_test(thread_count));
+    }
+  }
+
+  return case_result();
+}
+
+void Dhrystone::print_profile() {
+  const Dhry_Profile_Entry *entries = dhry_profile_entries();
+  const u64 overhead = dhry_profile_overhead();
+
+  // self time of each entry less the cost of reading the counter
+  u64 self[DHRY_PROFILE_COUNT];
+  u64 total = 0;
+  for (u32 i = 0; i < DHRY_PROFILE_COUNT; i++) {
+    const u64 cost = overhead * entries[i].calls;
+    self[i] = entries[i].cycles > cost ? entries[i].cycles - cost : 0;
+    total += self[i];
+  }
+
+  printer::Printer::Object profile_object(printer(), "profile");
+  printer()
+    .key("unit", dhry_profile_unit())
+    .key("overhead", NumberString(u32(overhead)))
+    .key("total", NumberString(double(total), "%0.0f"));
+
+  for (u32 i = 0; i < DHRY_PROFILE_COUNT; i++) {
+    const u32 calls = entries[i].calls;
+    const double per_call = calls ? double(self[i]) / calls : 0.0;
+    const double share = total ? double(self[i]) * 100.0 / total : 0.0;
+    printer::Printer::Object entry_object(printer(), dhry_profile_name(i));
+    printer()
+      .key("calls", NumberString(calls))
+      .key("perCall", NumberString(per_call, "%0.1f"))
+      .key("share", NumberString(share, "%0.1f%%"));
+    ResultArchive::record(
+      "dhrystone.profile." | StringView(dhry_profile_name(i)) | ".perCall",
+      per_call,
+      ResultArchive::IsHigherBetter::no);
+  }
+}
+
+bool Dhrystone::execute_thread_performance_test(u32 thread_count) {
+  Case cg(this, NumberString(thread_count, "%ldThreads"));
+
+  struct Worker {
+    u32 run_count = 0;
+    u32 duration_us = 0;
+    bool result = false;
+  };
+
+  Vector<Worker> workers;
+  workers.resize(thread_count);
+
+  WorkerPool pool(thread_count);
+  for (auto &worker : workers) {
+    worker.run_count = m_run_count;
+    pool.add(&worker, [](void *args) -> void * {
+      auto *worker = reinterpret_cast<Worker *>(args);
+      ClockTimer timer(ClockTimer::IsRunning::yes);
+      worker->result = dhry_main(worker->run_count) == 0;
+      timer.stop();
+      worker->duration_us = timer.microseconds();
+      return nullptr;
+    });
+  }
+  ClockTimer wall_timer(ClockTimer::IsRunning::yes);
+  pool.start();
+  TEST_EXPECT(pool.join());
+  wall_timer.stop();
+  TEST_ASSERT(is_success());
+
+  for (u32 i = 0; i < thread_count; i++) {
+    const Worker &worker = workers.at(i);
+    TEST_EXPECT(worker.result);
+    printer()
+      .open_object(NumberString(i, "thread%ld"))
+      .key("duration", NumberString(worker.duration_us, "%d us"))
+      .key("dmips", NumberString(dmips(m_run_count, worker.duration_us)))
+      .close_object();
+  }
+
+  const u32 aggregate_dmips =
+    dmips(u64(m_run_count) * thread_count, wall_timer.microseconds());
+  printer()
+    .key("threads", NumberString(thread_count))
+    .key("duration", NumberString(wall_timer.microseconds(), "%d us"))
+    .key("dmips", NumberString(aggregate_dmips))
+    .key(
+      "scaling",
+      NumberString(m_scaling.percent(thread_count, aggregate_dmips), "%d%%"));
+
+  ResultArchive::record(
+    NumberString(thread_count, "dhrystone.%ldThreads.dmips"),
+    aggregate_dmips);
+
+  return case_result();
+}
+
+u32 Dhrystone::measure(u32 run_count) {
+  ClockTimer timer(ClockTimer::IsRunning::yes);
+  const int result = dhry_main(run_count);
+  timer.stop();
+  // checked by the caller, calibration has no test context
+  if (result != 0) {
+    m_failure_count++;
+  }
+  return timer.microseconds() ? timer.microseconds() : 1;
+}
+
+u32 Dhrystone::dmips(u64 runs, u32 microseconds) {
+  const u64 duration_us = microseconds ? microseconds : 1;
+  return u32(runs * 1000000UL / (duration_us * 1757));
+}
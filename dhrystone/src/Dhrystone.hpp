@@ -0,0 +1,49 @@
+#ifndef DHRYSTONE_HPP
+#define DHRYSTONE_HPP
+
+#include <sys/Cli.hpp>
+#include <test/Test.hpp>
+
+#include "Scaling.hpp"
+
+class Dhrystone : public test::Test {
+public:
+  class Options {
+  public:
+    Options() = default;
+    explicit Options(const sys::Cli &cli);
+
+    // a run count of zero grows the count until one measurement takes at
+    // least the minimum duration
+    API_AF(Options, u32, run_count, 0);
+    API_AF(Options, u32, minimum_duration, 2000);
+    API_AF(Options, u32, sample_count, 3);
+
+    // run 1, 2, 4, ... instances in parallel threads up to the maximum
+    API_AF(Options, u32, maximum_thread_count, 1);
+  };
+
+  Dhrystone(const var::StringView name, const Options &options = Options());
+
+  bool execute_class_performance_case();
+
+private:
+  Options m_options;
+  u32 m_run_count = 0;
+  Scaling m_scaling;
+  // dhry_main() calls that failed (out of memory)
+  u32 m_failure_count = 0;
+
+  void print_profile();
+  bool execute_thread_performance_test(u32 thread_count);
+
+  u32 measure(u32 run_count);
+
+  // DMIPS is relative to the 1757 Dhrystones per second of the VAX 11/780
+  static u32 dmips(u64 runs, u32 microseconds);
+
+  // the benchmark counts runs with an int
+  static constexpr u32 maximum_run_count() { return 0x7fffffff; }
+};
+
+#endif // DHRYSTONE_HPP
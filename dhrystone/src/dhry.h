@@ -375,9 +375,10 @@
                 /* Berkeley UNIX C returns process times in seconds/HZ */
 
 #ifdef  NOSTRUCTASSIGN
-#define structassign(d, s)      memcpy(&(d), &(s), sizeof(d))
+#define structassign(d, s)      DHRY_TIME (DHRY_PROFILE_STRUCTASSIGN, \
+                                  memcpy(&(d), &(s), sizeof(d)))
 #else
-#define structassign(d, s)      d = s
+#define structassign(d, s)      DHRY_TIME (DHRY_PROFILE_STRUCTASSIGN, d = s)
 #endif
 
 #ifdef  NOENUM
@@ -396,7 +397,21 @@
 /* General definitions: */
 
 #include <stdio.h>
-                /* for strcpy, strcmp */
+#include <stdlib.h>
+#include <string.h>
+                /* for strcpy, strcmp, malloc */
+
+/* Each thread needs its own copy of the global variables to run      */
+/* independent instances in parallel. Targets without thread local    */
+/* storage can only run one instance at a time, the thread mode fails */
+/* when it is asked for more.                                         */
+#if defined __link
+#define DHRY_THREAD_LOCAL __thread
+#define DHRY_IS_REENTRANT 1
+#else
+#define DHRY_THREAD_LOCAL
+#define DHRY_IS_REENTRANT 0
+#endif
 
 #define Null 0 
                 /* Value of a Null pointer */
@@ -432,12 +447,15 @@ typedef struct record
           } variant;
       } Rec_Type, *Rec_Pointer;
 
+#include "dhry_profile.h"
+
 #if defined __cplusplus
 extern "C" {
 #endif
 
 #define NUMBER_OF_RUNS 1000000UL
-int dhry_main ();
+/* runs the benchmark loop number_of_runs times (at most INT_MAX) */
+int dhry_main (unsigned long number_of_runs);
 
 #if defined __cplusplus
 }
@@ -19,14 +19,14 @@
 
 /* Global Variables: */
 
-Rec_Pointer     Ptr_Glob,
-                Next_Ptr_Glob;
-int             Int_Glob;
-Boolean         Bool_Glob;
-char            Ch_1_Glob,
-                Ch_2_Glob;
-int             Arr_1_Glob [50];
-int             Arr_2_Glob [50] [50];
+DHRY_THREAD_LOCAL Rec_Pointer     Ptr_Glob,
+                                  Next_Ptr_Glob;
+DHRY_THREAD_LOCAL int             Int_Glob;
+DHRY_THREAD_LOCAL Boolean         Bool_Glob;
+DHRY_THREAD_LOCAL char            Ch_1_Glob,
+                                  Ch_2_Glob;
+DHRY_THREAD_LOCAL int             Arr_1_Glob [50];
+DHRY_THREAD_LOCAL int             Arr_2_Glob [50] [50];
 
 //extern char     *malloc (int);
 Enumeration     Func_1 ();
@@ -61,16 +61,16 @@ extern clock_t	clock();
 #define Too_Small_Time (2*HZ)
 #endif
 
-long            Begin_Time,
-                End_Time,
-                User_Time;
-float           Microseconds,
-                Dhrystones_Per_Second;
+DHRY_THREAD_LOCAL long            Begin_Time,
+                                  End_Time,
+                                  User_Time;
+DHRY_THREAD_LOCAL float           Microseconds,
+                                  Dhrystones_Per_Second;
 
 /* end of variables for time measurement */
 
 
-int dhry_main ()
+int dhry_main (unsigned long number_of_runs)
 /*****/
 
   /* main program, corresponds to procedures        */
@@ -85,11 +85,18 @@ int dhry_main ()
         Str_30          Str_2_Loc;
   REG   int             Run_Index;
   REG   int             Number_Of_Runs;
+        DHRY_FRAME
 
   /* Initializations */
 
   Next_Ptr_Glob = (Rec_Pointer) malloc (sizeof (Rec_Type));
   Ptr_Glob = (Rec_Pointer) malloc (sizeof (Rec_Type));
+  if (Next_Ptr_Glob == Null || Ptr_Glob == Null)
+  {
+    free (Next_Ptr_Glob);
+    free (Ptr_Glob);
+    return -1;
+  }
 
   Ptr_Glob->Ptr_Comp                    = Next_Ptr_Glob;
   Ptr_Glob->Discr                       = Ident_1;
@@ -105,7 +112,7 @@ int dhry_main ()
         /* Warning: With 16-Bit processors and Number_Of_Runs > 32000,  */
         /* overflow may occur for this array element.                   */
 
-  Number_Of_Runs = NUMBER_OF_RUNS;
+  Number_Of_Runs = number_of_runs;
 
   /***************/
   /* Start timer */
@@ -122,6 +129,7 @@ int dhry_main ()
   Begin_Time = clock();
 #endif
 
+  DHRY_ENTER ();
   for (Run_Index = 1; Run_Index <= Number_Of_Runs; ++Run_Index)
   {
 
@@ -130,7 +138,8 @@ int dhry_main ()
       /* Ch_1_Glob == 'A', Ch_2_Glob == 'B', Bool_Glob == true */
     Int_1_Loc = 2;
     Int_2_Loc = 3;
-    strcpy (Str_2_Loc, "DHRYSTONE PROGRAM, 2'ND STRING");
+    DHRY_TIME (DHRY_PROFILE_STRCPY,
+               strcpy (Str_2_Loc, "DHRYSTONE PROGRAM, 2'ND STRING"));
     Enum_Loc = Ident_2;
     Bool_Glob = ! Func_2 (Str_1_Loc, Str_2_Loc);
       /* Bool_Glob == 1 */
@@ -153,7 +162,8 @@ int dhry_main ()
           /* then, not executed */
         {
         Proc_6 (Ident_1, &Enum_Loc);
-        strcpy (Str_2_Loc, "DHRYSTONE PROGRAM, 3'RD STRING");
+        DHRY_TIME (DHRY_PROFILE_STRCPY,
+                   strcpy (Str_2_Loc, "DHRYSTONE PROGRAM, 3'RD STRING"));
         Int_2_Loc = Run_Index;
         Int_Glob = Run_Index;
         }
@@ -167,6 +177,7 @@ int dhry_main ()
       /* Int_1_Loc == 5 */
 
   } /* loop "for Run_Index" */
+  DHRY_EXIT (DHRY_PROFILE_MAIN);
 
   /**************/
   /* Stop timer */
@@ -239,6 +250,10 @@ int dhry_main ()
 #endif
   User_Time = End_Time - Begin_Time;
 
+  /* dhry_main() is called more than once per process */
+  free (Next_Ptr_Glob);
+  free (Ptr_Glob);
+
   if (0)
   {
 	 printf ("Measured time (%d) too small to obtain meaningful results\n", User_Time);
@@ -280,7 +295,9 @@ REG Rec_Pointer Ptr_Val_Par;
                                         /* == Ptr_Glob_Next */
   /* Local variable, initialized with Ptr_Val_Par->Ptr_Comp,    */
   /* corresponds to "rename" in Ada, "with" in Pascal           */
-  
+  DHRY_FRAME
+
+  DHRY_ENTER ();
   structassign (*Ptr_Val_Par->Ptr_Comp, *Ptr_Glob); 
   Ptr_Val_Par->variant.var_1.Int_Comp = 5;
   Next_Record->variant.var_1.Int_Comp 
@@ -301,6 +318,7 @@ REG Rec_Pointer Ptr_Val_Par;
   }
   else /* not executed */
     structassign (*Ptr_Val_Par, *Ptr_Val_Par->Ptr_Comp);
+  DHRY_EXIT (DHRY_PROFILE_PROC_1);
 } /* Proc_1 */
 
 
@@ -313,7 +331,9 @@ One_Fifty   *Int_Par_Ref;
 {
   One_Fifty  Int_Loc;  
   Enumeration   Enum_Loc;
+  DHRY_FRAME
 
+  DHRY_ENTER ();
   Int_Loc = *Int_Par_Ref + 10;
   do /* executed once */
     if (Ch_1_Glob == 'A')
@@ -324,6 +344,7 @@ One_Fifty   *Int_Par_Ref;
       Enum_Loc = Ident_1;
     } /* if */
   while (Enum_Loc != Ident_1); /* true */
+  DHRY_EXIT (DHRY_PROFILE_PROC_2);
 } /* Proc_2 */
 
 
@@ -335,10 +356,14 @@ Proc_3 (Ptr_Ref_Par)
 Rec_Pointer *Ptr_Ref_Par;
 
 {
+  DHRY_FRAME
+
+  DHRY_ENTER ();
   if (Ptr_Glob != Null)
     /* then, executed */
     *Ptr_Ref_Par = Ptr_Glob->Ptr_Comp;
   Proc_7 (10, Int_Glob, &Ptr_Glob->variant.var_1.Int_Comp);
+  DHRY_EXIT (DHRY_PROFILE_PROC_3);
 } /* Proc_3 */
 
 
@@ -347,10 +372,13 @@ Proc_4 () /* without parameters */
     /* executed once */
 {
   Boolean Bool_Loc;
+  DHRY_FRAME
 
+  DHRY_ENTER ();
   Bool_Loc = Ch_1_Glob == 'A';
   Bool_Glob = Bool_Loc | Bool_Glob;
   Ch_2_Glob = 'B';
+  DHRY_EXIT (DHRY_PROFILE_PROC_4);
 } /* Proc_4 */
 
 
@@ -358,8 +386,12 @@ Proc_5 () /* without parameters */
 /*******/
     /* executed once */
 {
+  DHRY_FRAME
+
+  DHRY_ENTER ();
   Ch_1_Glob = 'A';
   Bool_Glob = false;
+  DHRY_EXIT (DHRY_PROFILE_PROC_5);
 } /* Proc_5 */
 
 
@@ -23,8 +23,8 @@
         /* i.e. no register variables   */
 #endif
 
-extern  int     Int_Glob;
-extern  char    Ch_1_Glob;
+extern  DHRY_THREAD_LOCAL int     Int_Glob;
+extern  DHRY_THREAD_LOCAL char    Ch_1_Glob;
 
 
 Proc_6 (Enum_Val_Par, Enum_Ref_Par)
@@ -35,6 +35,9 @@ Proc_6 (Enum_Val_Par, Enum_Ref_Par)
 Enumeration  Enum_Val_Par;
 Enumeration *Enum_Ref_Par;
 {
+  DHRY_FRAME
+
+  DHRY_ENTER ();
   *Enum_Ref_Par = Enum_Val_Par;
   if (! Func_3 (Enum_Val_Par))
     /* then, not executed */
@@ -58,6 +61,7 @@ Enumeration *Enum_Ref_Par;
       *Enum_Ref_Par = Ident_3;
       break;
   } /* switch */
+  DHRY_EXIT (DHRY_PROFILE_PROC_6);
 } /* Proc_6 */
 
 
@@ -75,9 +79,12 @@ One_Fifty       Int_2_Par_Val;
 One_Fifty      *Int_Par_Ref;
 {
   One_Fifty Int_Loc;
+  DHRY_FRAME
 
+  DHRY_ENTER ();
   Int_Loc = Int_1_Par_Val + 2;
   *Int_Par_Ref = Int_2_Par_Val + Int_Loc;
+  DHRY_EXIT (DHRY_PROFILE_PROC_7);
 } /* Proc_7 */
 
 
@@ -93,7 +100,9 @@ int             Int_2_Par_Val;
 {
   REG One_Fifty Int_Index;
   REG One_Fifty Int_Loc;
+  DHRY_FRAME
 
+  DHRY_ENTER ();
   Int_Loc = Int_1_Par_Val + 5;
   Arr_1_Par_Ref [Int_Loc] = Int_2_Par_Val;
   Arr_1_Par_Ref [Int_Loc+1] = Arr_1_Par_Ref [Int_Loc];
@@ -103,6 +112,7 @@ int             Int_2_Par_Val;
   Arr_2_Par_Ref [Int_Loc] [Int_Loc-1] += 1;
   Arr_2_Par_Ref [Int_Loc+20] [Int_Loc] = Arr_1_Par_Ref [Int_Loc];
   Int_Glob = 5;
+  DHRY_EXIT (DHRY_PROFILE_PROC_8);
 } /* Proc_8 */
 
 
@@ -118,16 +128,18 @@ Capital_Letter   Ch_2_Par_Val;
 {
   Capital_Letter        Ch_1_Loc;
   Capital_Letter        Ch_2_Loc;
+  DHRY_FRAME
 
+  DHRY_ENTER ();
   Ch_1_Loc = Ch_1_Par_Val;
   Ch_2_Loc = Ch_1_Loc;
   if (Ch_2_Loc != Ch_2_Par_Val)
     /* then, executed */
-    return (Ident_1);
+    DHRY_RETURN (DHRY_PROFILE_FUNC_1, (Ident_1));
   else  /* not executed */
   {
     Ch_1_Glob = Ch_1_Loc;
-    return (Ident_2);
+    DHRY_RETURN (DHRY_PROFILE_FUNC_1, (Ident_2));
    }
 } /* Func_1 */
 
@@ -143,7 +155,9 @@ Str_30  Str_2_Par_Ref;
 {
   REG One_Thirty        Int_Loc;
       Capital_Letter    Ch_Loc;
+      DHRY_FRAME
 
+  DHRY_ENTER ();
   Int_Loc = 2;
   while (Int_Loc <= 2) /* loop body executed once */
     if (Func_1 (Str_1_Par_Ref[Int_Loc],
@@ -158,18 +172,18 @@ Str_30  Str_2_Par_Ref;
     Int_Loc = 7;
   if (Ch_Loc == 'R')
     /* then, not executed */
-    return (true);
+    DHRY_RETURN (DHRY_PROFILE_FUNC_2, (true));
   else /* executed */
   {
-    if (strcmp (Str_1_Par_Ref, Str_2_Par_Ref) > 0)
+    if (DHRY_STRCMP (Str_1_Par_Ref, Str_2_Par_Ref) > 0)
       /* then, not executed */
     {
       Int_Loc += 7;
       Int_Glob = Int_Loc;
-      return (true);
+      DHRY_RETURN (DHRY_PROFILE_FUNC_2, (true));
     }
     else /* executed */
-      return (false);
+      DHRY_RETURN (DHRY_PROFILE_FUNC_2, (false));
   } /* if Ch_Loc */
 } /* Func_2 */
 
@@ -181,12 +195,14 @@ Boolean Func_3 (Enum_Par_Val)
 Enumeration Enum_Par_Val;
 {
   Enumeration Enum_Loc;
+  DHRY_FRAME
 
+  DHRY_ENTER ();
   Enum_Loc = Enum_Par_Val;
   if (Enum_Loc == Ident_3)
     /* then, executed */
-    return (true);
+    DHRY_RETURN (DHRY_PROFILE_FUNC_3, (true));
   else /* not executed */
-    return (false);
+    DHRY_RETURN (DHRY_PROFILE_FUNC_3, (false));
 } /* Func_3 */
 
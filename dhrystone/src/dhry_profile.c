@@ -0,0 +1,79 @@
+/*
+ ****************************************************************************
+ *
+ *  Per-procedure profiling for the Dhrystone benchmark, see dhry_profile.h
+ *
+ ****************************************************************************
+ */
+
+#include "dhry.h"
+
+DHRY_THREAD_LOCAL Dhry_Profile_Entry Dhry_Profile [DHRY_PROFILE_COUNT];
+DHRY_THREAD_LOCAL Dhry_Frame *Dhry_Profile_Frame;
+
+static const char *const Dhry_Profile_Names [DHRY_PROFILE_COUNT] =
+{
+  "mainLoop",
+  "Proc_1",
+  "Proc_2",
+  "Proc_3",
+  "Proc_4",
+  "Proc_5",
+  "Proc_6",
+  "Proc_7",
+  "Proc_8",
+  "Func_1",
+  "Func_2",
+  "Func_3",
+  "strcpy",
+  "strcmp",
+  "structassign"
+};
+
+const Dhry_Profile_Entry *dhry_profile_entries (void)
+{
+  return Dhry_Profile;
+}
+
+void dhry_profile_reset (void)
+{
+  memset (Dhry_Profile, 0, sizeof (Dhry_Profile));
+}
+
+const char *dhry_profile_name (int index)
+{
+  if (index < 0 || index >= DHRY_PROFILE_COUNT)
+    return "";
+  return Dhry_Profile_Names [index];
+}
+
+unsigned long dhry_profile_overhead (void)
+{
+#if DHRY_PROFILE
+  unsigned long result = ~0UL;
+  int i;
+  for (i = 0; i < 100; i++)
+  {
+    const Dhry_Cycles start = dhry_cycles ();
+    const unsigned long elapsed = (Dhry_Cycles) (dhry_cycles () - start);
+    if (elapsed < result)
+      result = elapsed;
+  }
+  return result;
+#else
+  return 0;
+#endif
+}
+
+const char *dhry_profile_unit (void)
+{
+#if defined __x86_64__ || defined __i386__
+  return "tsc";
+#elif defined __aarch64__
+  return "cntvct";
+#elif defined DHRY_PROFILE_DWT
+  return "cycles";
+#else
+  return "ns";
+#endif
+}
@@ -0,0 +1,165 @@
+/*
+ ****************************************************************************
+ *
+ *  Per-procedure profiling for the Dhrystone benchmark
+ *
+ *  Build with -DDHRY_PROFILE=1 (the DHRYSTONE_PROFILE CMake option) to
+ *  time each procedure and the string and record copies of the main loop
+ *  with the cycle counter. Time spent in a nested call is only charged to
+ *  the callee so the shares of all entries add up to 100%.
+ *
+ *  The instrumentation adds a counter read or two per call, the application
+ *  subtracts dhry_profile_overhead () per call before computing the shares.
+ *  Use the default build for the score and this one to see where the time
+ *  goes.
+ *
+ ****************************************************************************
+ */
+
+#ifndef DHRY_PROFILE_H
+#define DHRY_PROFILE_H
+
+#ifndef DHRY_PROFILE
+#define DHRY_PROFILE 0
+#endif
+
+#if defined __cplusplus
+extern "C" {
+#endif
+
+enum
+{
+  DHRY_PROFILE_MAIN,
+  DHRY_PROFILE_PROC_1,
+  DHRY_PROFILE_PROC_2,
+  DHRY_PROFILE_PROC_3,
+  DHRY_PROFILE_PROC_4,
+  DHRY_PROFILE_PROC_5,
+  DHRY_PROFILE_PROC_6,
+  DHRY_PROFILE_PROC_7,
+  DHRY_PROFILE_PROC_8,
+  DHRY_PROFILE_FUNC_1,
+  DHRY_PROFILE_FUNC_2,
+  DHRY_PROFILE_FUNC_3,
+  DHRY_PROFILE_STRCPY,
+  DHRY_PROFILE_STRCMP,
+  DHRY_PROFILE_STRUCTASSIGN,
+  DHRY_PROFILE_COUNT
+};
+
+typedef struct
+{
+  unsigned long long    cycles;
+  unsigned long         calls;
+} Dhry_Profile_Entry;
+
+/* Cortex-M DWT->CYCCNT is 32 bits, differences are taken before it wraps */
+#if defined __x86_64__ || defined __i386__ || defined __aarch64__
+typedef unsigned long long Dhry_Cycles;
+#else
+typedef unsigned long Dhry_Cycles;
+#endif
+
+typedef struct Dhry_Frame
+{
+  Dhry_Cycles           start;
+  unsigned long long    children;
+  struct Dhry_Frame    *parent;
+} Dhry_Frame;
+
+        /* entries of the calling thread, indexed by DHRY_PROFILE_* */
+const Dhry_Profile_Entry *dhry_profile_entries (void);
+void dhry_profile_reset (void);
+const char *dhry_profile_name (int index);
+        /* name of the counter dhry_cycles () reads */
+const char *dhry_profile_unit (void);
+        /* smallest difference between two counter reads */
+unsigned long dhry_profile_overhead (void);
+
+#if DHRY_PROFILE
+
+#include <time.h>
+
+extern DHRY_THREAD_LOCAL Dhry_Profile_Entry Dhry_Profile [DHRY_PROFILE_COUNT];
+extern DHRY_THREAD_LOCAL Dhry_Frame *Dhry_Profile_Frame;
+
+static __inline__ Dhry_Cycles dhry_cycles (void)
+{
+#if defined __x86_64__ || defined __i386__
+  unsigned int low, high;
+  __asm__ __volatile__ ("rdtsc" : "=a" (low), "=d" (high));
+  return ((Dhry_Cycles) high << 32) | low;
+#elif defined __aarch64__
+  Dhry_Cycles value;
+  __asm__ __volatile__ ("mrs %0, cntvct_el0" : "=r" (value));
+  return value;
+#elif defined DHRY_PROFILE_DWT
+  /* the kernel must enable DWT->CYCCNT and allow unprivileged reads */
+  return *(volatile unsigned long *) 0xE0001004;
+#else
+  struct timespec now;
+  clock_gettime (CLOCK_REALTIME, &now);
+  return (Dhry_Cycles) now.tv_sec * 1000000000UL + now.tv_nsec;
+#endif
+}
+
+static __inline__ void dhry_profile_enter (Dhry_Frame *frame)
+{
+  frame->children = 0;
+  frame->parent = Dhry_Profile_Frame;
+  Dhry_Profile_Frame = frame;
+  frame->start = dhry_cycles ();
+}
+
+static __inline__ void dhry_profile_exit (Dhry_Frame *frame, int index)
+{
+  const unsigned long long elapsed = (Dhry_Cycles) (dhry_cycles () - frame->start);
+  Dhry_Profile [index].cycles += elapsed - frame->children;
+  Dhry_Profile [index].calls++;
+  Dhry_Profile_Frame = frame->parent;
+  if (frame->parent != Null)
+    frame->parent->children += elapsed;
+}
+
+static __inline__ int dhry_profile_strcmp (const char *s1, const char *s2)
+{
+  Dhry_Frame frame;
+  int result;
+  dhry_profile_enter (&frame);
+  result = strcmp (s1, s2);
+  dhry_profile_exit (&frame, DHRY_PROFILE_STRCMP);
+  return result;
+}
+
+        /* declares the frame, goes with the local variables */
+#define DHRY_FRAME                      Dhry_Frame Frame_Loc;
+#define DHRY_ENTER()                    dhry_profile_enter (&Frame_Loc)
+#define DHRY_EXIT(index)                dhry_profile_exit (&Frame_Loc, index)
+#define DHRY_RETURN(index, value) \
+  do { dhry_profile_exit (&Frame_Loc, index); return value; } while (0)
+#define DHRY_TIME(index, statement) \
+  do \
+  { \
+    Dhry_Frame Time_Frame; \
+    dhry_profile_enter (&Time_Frame); \
+    statement; \
+    dhry_profile_exit (&Time_Frame, index); \
+  } while (0)
+#define DHRY_STRCMP(s1, s2)             dhry_profile_strcmp (s1, s2)
+
+#else
+
+#define DHRY_FRAME
+#define DHRY_ENTER()                    ((void) 0)
+#define DHRY_EXIT(index)                ((void) 0)
+#define DHRY_RETURN(index, value)       return value
+#define DHRY_TIME(index, statement)     statement
+#define DHRY_STRCMP(s1, s2)             strcmp (s1, s2)
+
+#endif
+
+#if defined __cplusplus
+}
+#endif
+
+#endif /* DHRY_PROFILE_H */
@@ -1,9 +1,81 @@
+#include <chrono.hpp>
 #include <fs.hpp>
+#include <thread.hpp>
 #include <var.hpp>
 
+#include "CliOption.hpp"
 #include "FileTest.hpp"
+#include "PseudoRandom.hpp"
+#include "ResultArchive.hpp"
+#include "WorkerPool.hpp"
 
-FileTest::FileTest(const StringView path) : Test("FileTest") { m_path = path; }
+FileTest::Options::Options(const Cli &cli) {
+  const bool is_sequential =
+      cli.get_option("sequential", "run the sequential page/file size sweep") ==
+      "true";
+  const bool is_random =
+      cli.get_option("random", "run the random offset workload") == "true";
+  const bool is_durability =
+      cli.get_option("durability", "run the append with sync workload") ==
+      "true";
+  if (is_sequential || is_random || is_durability) {
+    set_sequential(is_sequential)
+        .set_random(is_random)
+        .set_durability(is_durability);
+  }
+
+  set_minimum_page_size(parse_u32_option(cli, "minPageSize",
+                                         "smallest read/write size in bytes",
+                                         minimum_page_size()));
+  set_maximum_page_size(parse_u32_option(
+      cli, "maxPageSize",
+      "largest read/write size in bytes, up to 65536 with enough RAM",
+      maximum_page_size()));
+  set_minimum_file_size(parse_u32_option(
+      cli, "minFileSize", "smallest file size in bytes", minimum_file_size()));
+  set_maximum_file_size(parse_u32_option(
+      cli, "maxFileSize", "largest file size in bytes", maximum_file_size()));
+
+  set_random_block_size(parse_u32_option(cli, "randomBlockSize",
+                                         "random read/write size in bytes",
+                                         random_block_size()));
+  set_random_file_size(parse_u32_option(cli, "randomFileSize",
+                                        "size of the file accessed randomly",
+                                        random_file_size()));
+  set_random_count(parse_u32_option(
+      cli, "randomCount", "number of random operations", random_count()));
+  set_random_seed(parse_u32_option(
+      cli, "seed", "seed for the random offsets", random_seed()));
+  set_read_percent(parse_u32_option(
+      cli, "readPercent",
+      "percent of random operations that are reads (0 to 100)",
+      read_percent()));
+
+  set_sync_page_size(parse_u32_option(cli, "syncPageSize",
+                                      "append size for the sync workload",
+                                      sync_page_size()));
+  set_sync_file_size(parse_u32_option(cli, "syncFileSize",
+                                      "bytes appended by the sync workload",
+                                      sync_file_size()));
+  set_maximum_sync_interval(parse_u32_option(
+      cli, "maxSyncInterval", "largest number of writes per sync",
+      maximum_sync_interval()));
+
+  set_maximum_thread_count(parse_u32_option(
+      cli, "maxThreads", "largest number of concurrent writers",
+      maximum_thread_count()));
+  set_stress_page_size(parse_u32_option(
+      cli, "stressPageSize", "write size used by each stress thread",
+      stress_page_size()));
+  set_stress_file_size(parse_u32_option(
+      cli, "stressFileSize", "bytes appended by each stress thread",
+      stress_file_size()));
+}
+
+FileTest::FileTest(const StringView path, const Options &options)
+    : Test("FileTest"), m_options(options) {
+  m_path = path;
+}
 
 bool FileTest::execute_class_api_case() {
 
@@ -43,64 +115,421 @@ bool FileTest::execute_class_api_case() {
 }
 
 bool FileTest::execute_class_performance_case() {
-  for (u32 i = 4; i < 32; i+=2) {
-    execute_file_append_performance_test(i, i * 128, i * 128 * 100);
+  if (m_options.is_sequential()) {
+    TEST_ASSERT(m_options.minimum_page_size() > 0);
+    TEST_ASSERT(m_options.minimum_file_size() > 0);
+
+    // u64 so the sweep can't wrap when the maximum is near 4GB
+    for (u64 page_size = m_options.minimum_page_size();
+         page_size <= m_options.maximum_page_size();
+         page_size *= sweep_factor()) {
+      for (u64 file_size = m_options.minimum_file_size();
+           file_size <= m_options.maximum_file_size();
+           file_size *= sweep_factor()) {
+        if (file_size >= page_size) {
+          TEST_ASSERT(
+              execute_file_append_performance_test(page_size, file_size));
+        }
+      }
+    }
+
+    printer()
+        .open_object("bestWrite")
+        .key("speed", NumberString(m_best_write.speed(), "%d KB/s"))
+        .key("pageSize", NumberString(m_best_write.page_size()))
+        .close_object()
+        .open_object("bestRead")
+        .key("speed", NumberString(m_best_read.speed(), "%d KB/s"))
+        .key("pageSize", NumberString(m_best_read.page_size()))
+        .close_object();
+
+    ResultArchive::record("FileTest.bestWrite.speed", m_best_write.speed());
+    ResultArchive::record("FileTest.bestRead.speed", m_best_read.speed());
+  }
+
+  if (m_options.is_random()) {
+    TEST_ASSERT(execute_file_random_performance_test(IsAligned::yes));
+    TEST_ASSERT(execute_file_random_performance_test(IsAligned::no));
+  }
+
+  if (m_options.is_durability()) {
+    for (u32 sync_interval = 1;
+         sync_interval && sync_interval <= m_options.maximum_sync_interval();
+         sync_interval *= sweep_factor()) {
+      TEST_ASSERT(execute_file_sync_performance_test(sync_interval));
+    }
+    // zero only syncs when the file is closed
+    TEST_ASSERT(execute_file_sync_performance_test(0));
   }
-  printer()
-      .open_object("bestWrite")
-      .key("speed", NumberString(m_best_write.speed(), "%d KB/s"))
-      .key("pageSize", NumberString(m_best_write.page_size()))
-      .close_object()
-      .open_object("bestRead")
-      .key("speed", NumberString(m_best_read.speed(), "%d KB/s"))
-      .key("pageSize", NumberString(m_best_read.page_size()))
-      .close_object();
 
   return case_result();
 }
 
-bool FileTest::execute_class_stress_case() { return case_result(); }
-
-bool FileTest::execute_file_append_performance_test(int count, int page_size,
-                                                    int file_size) {
+bool FileTest::execute_class_stress_case() {
+  TEST_ASSERT(m_options.maximum_thread_count() > 0);
+  for (u32 thread_count = 1; thread_count <= m_options.maximum_thread_count();
+       thread_count *= 2) {
+    TEST_ASSERT(
+        execute_file_concurrent_stress_test(thread_count, IsShared::no));
+    TEST_ASSERT(
+        execute_file_concurrent_stress_test(thread_count, IsShared::yes));
+  }
+  return case_result();
+}
 
-  const PathString file_path = m_path / NumberString(count, "test%ld.txt");
-  Case cg(this, file_path);
+bool FileTest::execute_file_append_performance_test(u32 page_size,
+                                                    u32 file_size) {
 
-  const auto name = Path::name(file_path);
+  const PathString file_path = m_path / "perf.txt";
+  const auto case_name =
+      NumberString(page_size, "page%ld") | NumberString(file_size, "file%ld");
+  const auto archive_prefix = "FileTest." | case_name;
+  Case cg(this, case_name);
 
   File f(File::IsOverwrite::yes, file_path);
   Data buffer(page_size);
 
   {
     Case cg(this, "append");
-    for (int i = 0; i < file_size; i += page_size) {
-      f.write(View(buffer).fill<u8>(i));
-      TEST_ASSERT(return_value() == page_size);
+    m_histogram.reset();
+    for (u32 offset = 0; offset < file_size; offset += page_size) {
+      View(buffer).fill<u8>(offset);
+      ClockTimer io_timer(ClockTimer::IsRunning::yes);
+      f.write(View(buffer));
+      io_timer.stop();
+      TEST_ASSERT(return_value() == int(page_size));
+      m_histogram.add(io_timer.microseconds());
     }
-    show_stats(name & "Append", page_size, file_size, StatsType::write);
+    const u32 speed =
+        show_stats("throughput", page_size, file_size, StatsType::write);
+    m_histogram.print(printer(), "latency", "us");
+    ResultArchive::record(archive_prefix | ".append.speed", speed);
+    ResultArchive::record(archive_prefix | ".append.latency.p99",
+                          m_histogram.percentile(99.0f),
+                          ResultArchive::IsHigherBetter::no);
   }
 
   {
     Case cg(this, "read");
     TEST_ASSERT(f.seek(0).is_success());
-    for (int i = 0; i < file_size; i += page_size) {
-      TEST_ASSERT(f.read(View(buffer)).return_value() == page_size);
+    m_histogram.reset();
+    for (u32 offset = 0; offset < file_size; offset += page_size) {
+      ClockTimer io_timer(ClockTimer::IsRunning::yes);
+      f.read(View(buffer));
+      io_timer.stop();
+      TEST_ASSERT(return_value() == int(page_size));
+      m_histogram.add(io_timer.microseconds());
+    }
+    const u32 speed =
+        show_stats("throughput", page_size, file_size, StatsType::read);
+    m_histogram.print(printer(), "latency", "us");
+    ResultArchive::record(archive_prefix | ".read.speed", speed);
+    ResultArchive::record(archive_prefix | ".read.latency.p99",
+                          m_histogram.percentile(99.0f),
+                          ResultArchive::IsHigherBetter::no);
+  }
+
+  TEST_ASSERT(FileSystem().remove(file_path).is_success());
+
+  return case_result();
+}
+
+bool FileTest::execute_file_random_performance_test(IsAligned is_aligned) {
+  const u32 block_size = m_options.random_block_size();
+  const u32 read_percent = m_options.read_percent();
+
+  Case cg(this, is_aligned == IsAligned::yes ? "randomAligned"
+                                             : "randomUnaligned");
+  TEST_ASSERT(block_size > 0 && m_options.random_file_size() >= block_size);
+  TEST_ASSERT(read_percent <= 100);
+
+  const u32 block_count = m_options.random_file_size() / block_size;
+  const u32 file_size = block_count * block_size;
+  const PathString file_path = m_path / "random.txt";
+  File f(File::IsOverwrite::yes, file_path);
+  Data buffer(block_size);
+
+  // fill the file first so every offset can be read
+  for (u32 offset = 0; offset < file_size; offset += block_size) {
+    TEST_ASSERT(f.write(View(buffer).fill<u8>(offset)).return_value() ==
+                int(block_size));
+  }
+
+  PseudoRandom random(m_options.random_seed());
+  Histogram read_histogram;
+  Histogram write_histogram;
+
+  ClockTimer run_timer(ClockTimer::IsRunning::yes);
+  for (u32 i = 0; i < m_options.random_count(); i++) {
+    const u32 offset = is_aligned == IsAligned::yes
+                           ? random.next(block_count) * block_size
+                           : random.next(file_size - block_size + 1);
+    const bool is_read = random.next(100) < read_percent;
+    if (is_read == false) {
+      View(buffer).fill<u8>(i);
+    }
+
+    ClockTimer io_timer(ClockTimer::IsRunning::yes);
+    f.seek(offset);
+    if (is_read) {
+      f.read(View(buffer));
+    } else {
+      f.write(View(buffer));
     }
+    io_timer.stop();
 
-    show_stats(name & "Read", page_size, file_size, StatsType::read);
+    // checked after the timer so the assert is not part of the latency
+    TEST_ASSERT(is_success());
+    TEST_ASSERT(return_value() == int(block_size));
+    (is_read ? read_histogram : write_histogram).add(io_timer.microseconds());
   }
+  run_timer.stop();
+
+  const u32 elapsed_us = run_timer.microseconds();
+  const u32 duration_us = elapsed_us ? elapsed_us : 1;
+  printer()
+      .key("blockSize", NumberString(block_size, "%d bytes"))
+      .key("size", NumberString(file_size, "%d bytes"))
+      .key("seed", NumberString(m_options.random_seed()))
+      .key("readPercent", NumberString(read_percent))
+      .key("operations", NumberString(m_options.random_count()))
+      .key("duration", NumberString(duration_us, "%d us"))
+      .key("iops",
+           NumberString(u32(u64(m_options.random_count()) * 1000000UL /
+                            duration_us),
+                        "%d ops/s"));
+
+  read_histogram.print(printer(), "readLatency", "us");
+  write_histogram.print(printer(), "writeLatency", "us");
+
+  const StringView archive_prefix = is_aligned == IsAligned::yes
+                                        ? "FileTest.randomAligned"
+                                        : "FileTest.randomUnaligned";
+  ResultArchive::record(archive_prefix | ".iops",
+                        u64(m_options.random_count()) * 1000000UL /
+                            duration_us);
+  ResultArchive::record(archive_prefix | ".readLatency.p99",
+                        read_histogram.percentile(99.0f),
+                        ResultArchive::IsHigherBetter::no);
+  ResultArchive::record(archive_prefix | ".writeLatency.p99",
+                        write_histogram.percentile(99.0f),
+                        ResultArchive::IsHigherBetter::no);
 
   TEST_ASSERT(FileSystem().remove(file_path).is_success());
 
   return case_result();
 }
 
-void FileTest::show_stats(const var::StringView name, u32 page_size,
-                          u32 file_size, StatsType type) {
+bool FileTest::execute_file_sync_performance_test(u32 sync_interval) {
+  const u32 page_size = m_options.sync_page_size();
+  const u32 file_size = m_options.sync_file_size();
+
+  const NumberString case_name(sync_interval, "syncEvery%ld");
+  Case cg(this, sync_interval ? StringView(case_name.cstring())
+                              : StringView("syncAtClose"));
+  TEST_ASSERT(page_size > 0);
+
+  const PathString file_path = m_path / "sync.txt";
+  Data buffer(page_size);
+  Histogram sync_histogram;
+  m_histogram.reset();
+
+  // longest time data sat written but not synced -- what a power loss
+  // at the worst moment would cost
+  u32 max_unsynced_us = 0;
+  ClockTimer unsynced_timer;
+  ClockTimer close_timer;
+  ClockTimer run_timer(ClockTimer::IsRunning::yes);
+  {
+    File f(File::IsOverwrite::yes, file_path);
+    u32 write_count = 0;
+    for (u32 offset = 0; offset < file_size; offset += page_size) {
+      View(buffer).fill<u8>(offset);
+      if (unsynced_timer.is_running() == false) {
+        unsynced_timer.restart();
+      }
+
+      ClockTimer io_timer(ClockTimer::IsRunning::yes);
+      f.write(View(buffer));
+      io_timer.stop();
+      TEST_ASSERT(return_value() == int(page_size));
+      m_histogram.add(io_timer.microseconds());
+
+      if (sync_interval && (++write_count % sync_interval == 0)) {
+        ClockTimer sync_timer(ClockTimer::IsRunning::yes);
+        f.sync();
+        sync_timer.stop();
+        unsynced_timer.stop();
+        TEST_ASSERT(is_success());
+        sync_histogram.add(sync_timer.microseconds());
+        if (unsynced_timer.microseconds() > max_unsynced_us) {
+          max_unsynced_us = unsynced_timer.microseconds();
+        }
+      }
+    }
+
+    // close() does not flush the device cache, the writes after the last
+    // sync are only durable once this sync returns
+    close_timer.start();
+    if (unsynced_timer.is_running()) {
+      f.sync();
+      unsynced_timer.stop();
+      TEST_ASSERT(is_success());
+      if (unsynced_timer.microseconds() > max_unsynced_us) {
+        max_unsynced_us = unsynced_timer.microseconds();
+      }
+    }
+  }
+  close_timer.stop();
+  run_timer.stop();
+
   constexpr u32 factor = 1000000UL / 1024UL;
-  u32 duration_us = case_timer().microseconds();
-  const u32 speed = file_size * factor / duration_us;
+  const u32 elapsed_us = run_timer.microseconds();
+  const u32 duration_us = elapsed_us ? elapsed_us : 1;
+  printer()
+      .key("pageSize", NumberString(page_size, "%d bytes"))
+      .key("size", NumberString(file_size, "%d bytes"))
+      .key("syncInterval", NumberString(sync_interval, "%d writes"))
+      .key("duration", NumberString(duration_us, "%d us"))
+      .key("speed", NumberString(u32(u64(file_size) * factor / duration_us),
+                                 "%d KB/s"))
+      .key("syncClose", NumberString(close_timer.microseconds(), "%d us"))
+      .key("maxUnsynced", NumberString(max_unsynced_us, "%d us"));
+
+  m_histogram.print(printer(), "writeLatency", "us");
+  sync_histogram.print(printer(), "syncLatency", "us");
+
+  const auto archive_prefix =
+      "FileTest." | (sync_interval ? StringView(case_name.cstring())
+                                   : StringView("syncAtClose"));
+  ResultArchive::record(archive_prefix | ".speed",
+                        u64(file_size) * factor / duration_us);
+  ResultArchive::record(archive_prefix | ".syncLatency.p99",
+                        sync_histogram.percentile(99.0f),
+                        ResultArchive::IsHigherBetter::no);
+  ResultArchive::record(archive_prefix | ".maxUnsynced", max_unsynced_us,
+                        ResultArchive::IsHigherBetter::no);
+
+  TEST_ASSERT(FileSystem().remove(file_path).is_success());
+
+  return case_result();
+}
+
+bool FileTest::execute_file_concurrent_stress_test(u32 thread_count,
+                                                   IsShared is_shared) {
+  Case cg(this, (is_shared == IsShared::yes ? "sharedFile" : "privateFile") |
+                    NumberString(thread_count, "%ldThreads"));
+
+  const u32 page_size = m_options.stress_page_size();
+  TEST_ASSERT(page_size > 0);
+
+  struct Worker {
+    PathString path;
+    u32 page_size = 0;
+    u32 file_size = 0;
+    u32 duration_us = 0;
+    u32 max_write_us = 0;
+    bool result = false;
+  };
+
+  Vector<Worker> workers;
+  workers.resize(thread_count);
+  for (u32 i = 0; i < thread_count; i++) {
+    Worker &worker = workers.at(i);
+    worker.path = is_shared == IsShared::yes
+                      ? m_path / "shared.txt"
+                      : m_path / NumberString(i, "thread%ld.txt");
+    worker.page_size = page_size;
+    worker.file_size = m_options.stress_file_size();
+    // each worker opens its own descriptor in append mode
+    TEST_ASSERT(File(File::IsOverwrite::yes, worker.path).is_success());
+  }
+
+  WorkerPool pool(thread_count);
+  for (auto &worker : workers) {
+    pool.add(&worker, [](void *args) -> void * {
+      auto *worker = reinterpret_cast<Worker *>(args);
+      File f(worker->path, OpenMode::append_write_only());
+      Data buffer(worker->page_size);
+      View(buffer).fill<u8>(worker->page_size);
+      ClockTimer timer(ClockTimer::IsRunning::yes);
+      for (u32 offset = 0; offset < worker->file_size;
+           offset += worker->page_size) {
+        ClockTimer write_timer(ClockTimer::IsRunning::yes);
+        const int result = f.write(View(buffer)).return_value();
+        write_timer.stop();
+        if (result != int(worker->page_size)) {
+          return nullptr;
+        }
+        if (write_timer.microseconds() > worker->max_write_us) {
+          worker->max_write_us = write_timer.microseconds();
+        }
+      }
+      timer.stop();
+      worker->duration_us = timer.microseconds();
+      worker->result = true;
+      return nullptr;
+    });
+  }
+  ClockTimer wall_timer(ClockTimer::IsRunning::yes);
+  pool.start();
+  TEST_EXPECT(pool.join());
+  wall_timer.stop();
+  TEST_ASSERT(is_success());
+
+  constexpr u32 factor = 1000000UL / 1024UL;
+  u64 total_size = 0;
+  for (u32 i = 0; i < thread_count; i++) {
+    const Worker &worker = workers.at(i);
+    TEST_EXPECT(worker.result);
+    const u32 duration_us = worker.duration_us ? worker.duration_us : 1;
+    printer()
+        .open_object(NumberString(i, "thread%ld"))
+        .key("duration", NumberString(worker.duration_us, "%d us"))
+        .key("speed",
+             NumberString(u32(u64(worker.file_size) * factor / duration_us),
+                          "%d KB/s"))
+        .key("maxWrite", NumberString(worker.max_write_us, "%d us"))
+        .close_object();
+    total_size += worker.file_size;
+  }
+
+  const u32 elapsed_us = wall_timer.microseconds();
+  const u32 duration_us = elapsed_us ? elapsed_us : 1;
+  const u32 speed = total_size * factor / duration_us;
+  Scaling &scaling = m_scaling[is_shared == IsShared::yes ? 1 : 0];
+  printer()
+      .key("threads", NumberString(thread_count))
+      .key("size", NumberString(u32(total_size), "%d bytes"))
+      .key("duration", NumberString(duration_us, "%d us"))
+      .key("speed", NumberString(speed, "%d KB/s"))
+      .key("scaling",
+           NumberString(scaling.percent(thread_count, speed), "%d%%"));
+
+  ResultArchive::record((is_shared == IsShared::yes ? "FileTest.sharedFile"
+                                                    : "FileTest.privateFile") |
+                            NumberString(thread_count, "%ldThreads.speed"),
+                        speed);
+
+  if (is_shared == IsShared::yes) {
+    File shared_file(workers.at(0).path);
+    TEST_EXPECT(shared_file.size() == total_size);
+  }
+
+  for (u32 i = 0; i < (is_shared == IsShared::yes ? 1 : thread_count); i++) {
+    TEST_ASSERT(FileSystem().remove(workers.at(i).path).is_success());
+  }
+
+  return case_result();
+}
+
+u32 FileTest::show_stats(const var::StringView name, u32 page_size,
+                         u32 file_size, StatsType type) {
+  constexpr u32 factor = 1000000UL / 1024UL;
+  const u32 elapsed_us = case_timer().microseconds();
+  const u32 duration_us = elapsed_us ? elapsed_us : 1;
+  // u64 because large files overflow file_size * factor
+  const u32 speed = u64(file_size) * factor / duration_us;
 
   Stats *const stats = type == StatsType::write ? &m_best_write : &m_best_read;
 
@@ -113,6 +542,8 @@ void FileTest::show_stats(const var::StringView name, u32 page_size,
       .key("pageSize", NumberString(page_size, "%d bytes"))
       .key("size", NumberString(file_size, "%d bytes"))
       .key("duration", NumberString(duration_us, "%d us"))
-      .key("speed", NumberString(file_size * factor / duration_us, "%d KB/s"))
+      .key("speed", NumberString(speed, "%d KB/s"))
       .close_object();
+
+  return speed;
 }
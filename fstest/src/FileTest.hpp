@@ -1,12 +1,51 @@
 #ifndef FILETEST_HPP
 #define FILETEST_HPP
 
+#include <sys.hpp>
 #include <test.hpp>
 #include <var.hpp>
 
+#include "Histogram.hpp"
+#include "Scaling.hpp"
+
 class FileTest : public Test {
 public:
-  FileTest(const StringView path);
+  class Options {
+  public:
+    Options() = default;
+    explicit Options(const Cli &cli);
+
+    // workloads to run, all of them if none are selected
+    API_AB(Options, sequential, true);
+    API_AB(Options, random, true);
+    API_AB(Options, durability, true);
+
+    // page and file sizes are swept by multiplying by 4 up to the maximum,
+    // larger pages need more than the 64 KiB of application RAM and larger
+    // files take a long time on target so both are opt-in
+    API_AF(Options, u32, minimum_page_size, 64);
+    API_AF(Options, u32, maximum_page_size, 4096);
+    API_AF(Options, u32, minimum_file_size, 16 * 1024);
+    API_AF(Options, u32, maximum_file_size, 1024 * 1024);
+
+    API_AF(Options, u32, random_block_size, 512);
+    API_AF(Options, u32, random_file_size, 1024 * 1024);
+    API_AF(Options, u32, random_count, 2000);
+    API_AF(Options, u32, random_seed, 1);
+    API_AF(Options, u32, read_percent, 50);
+
+    // sync after every 1, 4, 16, ... writes up to the maximum then only at close
+    API_AF(Options, u32, sync_page_size, 512);
+    API_AF(Options, u32, sync_file_size, 256 * 1024);
+    API_AF(Options, u32, maximum_sync_interval, 64);
+
+    // stress doubles the number of threads up to the maximum
+    API_AF(Options, u32, maximum_thread_count, 8);
+    API_AF(Options, u32, stress_page_size, 512);
+    API_AF(Options, u32, stress_file_size, 256 * 1024);
+  };
+
+  FileTest(const StringView path, const Options &options = Options());
 
   bool execute_class_api_case();
   bool execute_class_performance_case();
@@ -22,20 +61,27 @@ private:
     read, write
   };
 
+  enum class IsAligned { no, yes };
+  enum class IsShared { no, yes };
+
   PathString m_path;
+  Options m_options;
   Stats m_best_read;
   Stats m_best_write;
+  Histogram m_histogram;
+  // private files and shared file
+  Scaling m_scaling[2];
 
-  bool execute_file_append_performance_test(int count, int page_size,
-                                            int file_size);
-
-  void show_stats(const StringView name, u32 page_size, u32 file_size, StatsType type);
-
-
+  bool execute_file_append_performance_test(u32 page_size, u32 file_size);
+  bool execute_file_random_performance_test(IsAligned is_aligned);
+  bool execute_file_sync_performance_test(u32 sync_interval);
+  bool execute_file_concurrent_stress_test(u32 thread_count,
+                                           IsShared is_shared);
 
+  u32 show_stats(const StringView name, u32 page_size, u32 file_size, StatsType type);
 
-  static constexpr size_t max_page_size(){
-    return 4096;
+  static constexpr u32 sweep_factor(){
+    return 4;
   }
 };
 
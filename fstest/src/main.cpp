@@ -7,6 +7,8 @@
 
 #include "DirTest.hpp"
 #include "FileTest.hpp"
+#include "Repeat.hpp"
+#include "ResultArchive.hpp"
 
 int main(int argc, char *argv[]) {
   Cli cli(argc, argv);
@@ -16,11 +18,18 @@ int main(int argc, char *argv[]) {
                                         .set_name("fstest")
                                         .set_version(SL_CONFIG_VERSION_STRING));
 
+    ResultArchive::Scope archive_scope(cli, "fstest", SL_CONFIG_VERSION_STRING,
+                                       SOS_GIT_HASH);
+
     const auto path_argument = cli.get_option("path");
     const PathString path = path_argument.is_empty() ? "/home" : path_argument;
 
-    DirTest(path).execute(cli);
-    FileTest(path).execute(cli);
+    const auto execute_flags = Test::parse_execution_flags(cli);
+    const FileTest::Options file_options(cli);
+    const Repeat repeat(cli);
+    repeat.execute([&] { return DirTest(path); }, execute_flags);
+    repeat.execute([&] { return FileTest(path, file_options); },
+                   execute_flags);
   }
 
   return 0;
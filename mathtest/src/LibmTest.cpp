@@ -0,0 +1,205 @@
+#include <chrono.hpp>
+#include <thread.hpp>
+#include <var.hpp>
+
+#include "CliOption.hpp"
+#include "LibmTest.hpp"
+#include "ResultArchive.hpp"
+#include "WorkerPool.hpp"
+
+using namespace chrono;
+using namespace sys;
+using namespace test;
+using namespace thread;
+using namespace var;
+
+namespace {
+// keeps the loop results alive
+volatile double result_sink;
+} // namespace
+
+LibmTest::Options::Options(const Cli &cli) {
+  set_sweep_count(parse_u32_option(
+    cli,
+    "sweepCount",
+    "inputs per function in the --libm accuracy sweep (default 1000000)",
+    sweep_count()));
+  set_thread_count(parse_u32_option(
+    cli,
+    "threads",
+    "threads sharing the --libm accuracy sweep (default 4)",
+    thread_count()));
+  set_call_count(parse_u32_option(
+    cli,
+    "calls",
+    "calls per function in the --libm timing (default 100000)",
+    call_count()));
+  set_sample_count(parse_u32_option(
+    cli,
+    "samples",
+    "loops per function, the fastest is reported (default 3)",
+    sample_count()));
+}
+
+LibmTest::LibmTest(const StringView name, const Options &options)
+  : Test(name), m_options(options) {}
+
+bool LibmTest::execute_class_api_case() {
+  TEST_ASSERT(m_options.thread_count() > 0);
+  TEST_ASSERT(m_options.sweep_count() > 0);
+
+  printer()
+    .key("sweepCount", NumberString(m_options.sweep_count()))
+    .key("threads", NumberString(m_options.thread_count()));
+
+  for (u32 idx = 0; idx < num_libm_count(); idx++) {
+    const num_libm_t *libm = num_libm_get(idx);
+    if (is_selected(*libm)) {
+      TEST_EXPECT(execute_sweep(*libm));
+    }
+  }
+
+  return case_result();
+}
+
+bool LibmTest::execute_class_performance_case() {
+  TEST_ASSERT(m_options.call_count() > 0);
+  TEST_ASSERT(m_options.sample_count() > 0);
+
+  printer()
+    .key("calls", NumberString(m_options.call_count()))
+    .key("samples", NumberString(m_options.sample_count()));
+
+  for (u32 idx = 0; idx < num_libm_count(); idx++) {
+    const num_libm_t *libm = num_libm_get(idx);
+    if (is_selected(*libm)) {
+      TEST_EXPECT(execute_timing(*libm));
+    }
+  }
+
+  return case_result();
+}
+
+bool LibmTest::execute_sweep(const num_libm_t &libm) {
+  struct Worker {
+    const num_libm_t *libm = nullptr;
+    u32 begin = 0;
+    u32 end = 0;
+    u32 count = 0;
+    double maximum_ulp = 0.0;
+    double total_ulp = 0.0;
+    double worst_x = 0.0;
+    double worst_y = 0.0;
+  };
+
+  const u32 thread_count = m_options.thread_count();
+  const u32 sweep_count = m_options.sweep_count();
+  Vector<Worker> workers;
+  workers.resize(thread_count);
+
+  WorkerPool pool(thread_count);
+  for (u32 i = 0; i < thread_count; i++) {
+    Worker &worker = workers.at(i);
+    worker.libm = &libm;
+    worker.begin = u32(u64(sweep_count) * i / thread_count);
+    worker.end = u32(u64(sweep_count) * (i + 1) / thread_count);
+    worker.count = sweep_count;
+    pool.add(&worker, [](void *args) -> void * {
+      auto *worker = reinterpret_cast<Worker *>(args);
+      for (u32 idx = worker->begin; idx < worker->end; idx++) {
+        double x;
+        double y;
+        num_libm_input(worker->libm, idx, worker->count, &x, &y);
+        const double ulp = num_libm_ulp_error(worker->libm, x, y);
+        worker->total_ulp += ulp;
+        if (ulp > worker->maximum_ulp) {
+          worker->maximum_ulp = ulp;
+          worker->worst_x = x;
+          worker->worst_y = y;
+        }
+      }
+      return nullptr;
+    });
+  }
+  ClockTimer timer(ClockTimer::IsRunning::yes);
+  pool.start();
+  TEST_EXPECT(pool.join());
+  timer.stop();
+  TEST_ASSERT(is_success());
+
+  const Worker *worst = &workers.at(0);
+  double total_ulp = 0.0;
+  for (const auto &worker : workers) {
+    total_ulp += worker.total_ulp;
+    if (worker.maximum_ulp > worst->maximum_ulp) {
+      worst = &worker;
+    }
+  }
+
+  const bool is_float = StringView(libm.type) == "float";
+  const bool is_reference =
+    num_libm_reference_bits(&libm) > (is_float ? 24 : 53);
+  const char *input_format = is_float ? "%0.9g" : "%0.17g";
+
+  printer::Printer::Object libm_object(printer(), libm.name);
+  printer()
+    .key("type", libm.type)
+    .key("duration", NumberString(timer.milliseconds(), "%ld ms"))
+    .key("referenceBits", NumberString(num_libm_reference_bits(&libm)));
+
+  if (is_reference == false) {
+    printer().key("maxUlp", "no wider reference");
+    return case_result();
+  }
+
+  printer()
+    .key("maxUlp", NumberString(worst->maximum_ulp, "%0.3f"))
+    .key("meanUlp", NumberString(total_ulp / sweep_count, "%0.4f"))
+    .key("budgetUlp", NumberString(libm.ulp_budget, "%0.3f"))
+    .key("worstX", NumberString(worst->worst_x, input_format));
+  if (libm.y_minimum != libm.y_maximum) {
+    printer().key("worstY", NumberString(worst->worst_y, input_format));
+  }
+
+  ResultArchive::record(
+    "mathtest.libm." | StringView(libm.name) | ".maxUlp",
+    worst->maximum_ulp,
+    ResultArchive::IsHigherBetter::no);
+
+  TEST_EXPECT(worst->maximum_ulp <= libm.ulp_budget);
+  return case_result();
+}
+
+bool LibmTest::execute_timing(const num_libm_t &libm) {
+  const u32 call_count = m_options.call_count();
+  // the timing walks the linear domain, log spaced inputs start at the middle
+  // of the range so that every call does comparable work
+  const double x_minimum = libm.is_logarithmic ? 0.5 : libm.x_minimum;
+  const double x_maximum = libm.is_logarithmic ? 2.0 : libm.x_maximum;
+  const double step = (x_maximum - x_minimum) / call_count;
+  const double y = (libm.y_minimum + libm.y_maximum) / 2 + 0.375;
+
+  u32 duration_us = 0;
+  for (u32 i = 0; i < m_options.sample_count(); i++) {
+    ClockTimer timer(ClockTimer::IsRunning::yes);
+    result_sink = libm.loop(x_minimum, step, y, call_count);
+    timer.stop();
+    if (i == 0 || timer.microseconds() < duration_us) {
+      duration_us = timer.microseconds();
+    }
+  }
+
+  const double ns = duration_us * 1000.0 / call_count;
+  printer::Printer::Object libm_object(printer(), libm.name);
+  printer()
+    .key("type", libm.type)
+    .key("ns", NumberString(ns, "%0.1f"))
+    .key("mcalls", NumberString(ns > 0.0 ? 1000.0 / ns : 0.0, "%0.2f"));
+
+  ResultArchive::record(
+    "mathtest.libm." | StringView(libm.name) | ".ns",
+    ns,
+    ResultArchive::IsHigherBetter::no);
+
+  return case_result();
+}
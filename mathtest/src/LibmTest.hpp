@@ -0,0 +1,44 @@
+#ifndef LIBMTEST_HPP
+#define LIBMTEST_HPP
+
+#include <sys/Cli.hpp>
+#include <test/Test.hpp>
+
+#include "num_libm.h"
+
+class LibmTest : public test::Test {
+public:
+  class Options {
+  public:
+    Options() = default;
+    explicit Options(const sys::Cli &cli);
+
+    // inputs per function in the accuracy sweep, split across the threads
+    API_AF(Options, u32, sweep_count, 1000000);
+    API_AF(Options, u32, thread_count, 4);
+    // calls per function in the timing, the fastest of sample_count is kept
+    API_AF(Options, u32, call_count, 100000);
+    API_AF(Options, u32, sample_count, 3);
+
+    // type flags from num_test.h, entries match like the tests
+    API_AF(Options, u32, o_flags, 0);
+  };
+
+  LibmTest(const var::StringView name, const Options &options);
+
+  bool execute_class_api_case();
+  bool execute_class_performance_case();
+
+private:
+  Options m_options;
+
+  bool is_selected(const num_libm_t &libm) const {
+    return (libm.o_execute_flags & m_options.o_flags())
+           == libm.o_execute_flags;
+  }
+
+  bool execute_sweep(const num_libm_t &libm);
+  bool execute_timing(const num_libm_t &libm);
+};
+
+#endif // LIBMTEST_HPP
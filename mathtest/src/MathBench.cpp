@@ -0,0 +1,231 @@
+#include <chrono.hpp>
+#include <var.hpp>
+
+#include "CliOption.hpp"
+#include "MathBench.hpp"
+#include "PseudoRandom.hpp"
+#include "ResultArchive.hpp"
+#include "num_bench.h"
+
+using namespace chrono;
+using namespace sys;
+using namespace test;
+using namespace var;
+
+namespace {
+// keeps the loop results alive
+volatile u64 result_sink;
+} // namespace
+
+MathBench::Options::Options(const Cli &cli) {
+  set_iteration_count(parse_u32_option(
+    cli,
+    "iterations",
+    "operations per throughput loop (default 1000000)",
+    iteration_count()));
+  set_sample_count(parse_u32_option(
+    cli,
+    "samples",
+    "loops per operation, the fastest is reported (default 3)",
+    sample_count()));
+  set_batch_size(parse_u32_option(
+    cli,
+    "batchSize",
+    "elements per array in the batch comparison (default 256)",
+    batch_size()));
+}
+
+MathBench::MathBench(const StringView name, const Options &options)
+  : Test(name), m_options(options) {}
+
+bool MathBench::execute_class_performance_case() {
+  TEST_ASSERT(m_options.iteration_count() > 0);
+  TEST_ASSERT(m_options.sample_count() > 0);
+  TEST_ASSERT(m_options.batch_size() > 0);
+
+  printer()
+    .key("iterations", NumberString(m_options.iteration_count()))
+    .key("samples", NumberString(m_options.sample_count()))
+    .key("batchSize", NumberString(m_options.batch_size()))
+    .key("batchIsa", num_batch_isa());
+
+  const u32 o_flags = m_options.o_flags();
+  for (u32 idx = 0; idx < num_bench_count(); idx++) {
+    const num_bench_t *bench = num_bench_get(idx);
+    if ((bench->o_execute_flags & o_flags) == bench->o_execute_flags) {
+      TEST_EXPECT(execute_bench(*bench));
+    }
+  }
+
+  for (u32 op = 0; op < NUM_BATCH_COUNT; op++) {
+    const num_batch_t *batch = num_batch_get(num_batch_op_t(op));
+    if ((batch->o_execute_flags & o_flags) == batch->o_execute_flags) {
+      TEST_EXPECT(execute_batch(num_batch_op_t(op)));
+    }
+  }
+
+  return case_result();
+}
+
+bool MathBench::execute_bench(const num_bench_t &bench) {
+  const double loop_ns = measure(bench.loop, bench.a, bench.b);
+  const double baseline_ns = measure(bench.baseline, bench.a, bench.b);
+
+  // the operation is what the loop costs beyond stepping and folding
+  const double ns = loop_ns > baseline_ns ? loop_ns - baseline_ns : 0.0;
+
+  printer::Printer::Object bench_object(printer(), bench.name);
+  printer()
+    .key("type", bench.type)
+    .key("op", StringView(bench.op_str))
+    .key("loopNs", NumberString(loop_ns, "%0.3f"))
+    .key("baselineNs", NumberString(baseline_ns, "%0.3f"))
+    .key("ns", NumberString(ns, "%0.3f"))
+    .key("mops", NumberString(ns > 0.0 ? 1000.0 / ns : 0.0, "%0.1f"));
+
+  if (bench.float_loop) {
+    const double float_loop_ns =
+      measure(bench.float_loop, bench.float_a, bench.float_b);
+    const double float_baseline_ns =
+      measure(bench.float_baseline, bench.float_a, bench.float_b);
+    const double float_ns = float_loop_ns > float_baseline_ns
+                              ? float_loop_ns - float_baseline_ns
+                              : 0.0;
+    // above 1x the fixed-point operation is faster than float
+    printer()
+      .key("floatNs", NumberString(float_ns, "%0.3f"))
+      .key(
+        "vsFloat",
+        NumberString(ns > 0.0 ? float_ns / ns : 0.0, "%0.2fx"));
+  }
+
+  ResultArchive::record(
+    "mathtest." | StringView(bench.name) | ".ns",
+    ns,
+    ResultArchive::IsHigherBetter::no);
+
+  return case_result();
+}
+
+double MathBench::measure(
+  num_bench_loop loop,
+  const operand_t &a,
+  const operand_t &b) {
+  u32 duration_us = 0;
+  for (u32 i = 0; i < m_options.sample_count(); i++) {
+    ClockTimer timer(ClockTimer::IsRunning::yes);
+    const operand_t sum = loop(a, b, m_options.iteration_count());
+    timer.stop();
+    result_sink = sum.op_u64;
+
+    if (i == 0 || timer.microseconds() < duration_us) {
+      duration_us = timer.microseconds();
+    }
+  }
+  return duration_us * 1000.0 / m_options.iteration_count();
+}
+
+bool MathBench::execute_batch(num_batch_op_t op) {
+  const num_batch_t &batch = *num_batch_get(op);
+  const u32 batch_size = m_options.batch_size();
+
+  Vector<operand_t> a;
+  Vector<operand_t> b;
+  Vector<operand_t> batch_out;
+  Vector<operand_t> scalar_out;
+  a.resize(batch_size);
+  b.resize(batch_size);
+  batch_out.resize(batch_size);
+  scalar_out.resize(batch_size);
+
+  // the same operands every run, divisors are never zero
+  PseudoRandom random(op + 1);
+  for (u32 i = 0; i < batch_size; i++) {
+    a.at(i).op_u64 = (u64(random.next()) << 32) | random.next();
+    b.at(i).op_u64 = (u64(random.next()) << 32) | random.next();
+    if (StringView(batch.type) == "s64") {
+      // stay clear of signed overflow, which the kernels wrap
+      a.at(i).op_s64 >>= 2;
+      b.at(i).op_s64 >>= 2;
+    } else if (StringView(batch.type) == "float") {
+      a.at(i).op_f = (float(random.next(2000000)) - 1000000.0f) / 1000.0f;
+      b.at(i).op_f = (float(random.next(1000000)) + 1.0f) / 1000.0f;
+    } else if (StringView(batch.type) == "double") {
+      a.at(i).op_d = (double(random.next(2000000)) - 1000000.0) / 1000.0;
+      b.at(i).op_d = (double(random.next(1000000)) + 1.0) / 1000.0;
+    }
+  }
+
+  const u32 scalar_us = measure_batch(op, true, a, b, scalar_out);
+  const u32 batch_us = measure_batch(op, false, a, b, batch_out);
+
+  // whole batches of at least iteration_count elements were timed
+  const double element_count =
+    double((m_options.iteration_count() + batch_size - 1) / batch_size)
+    * batch_size;
+  const double scalar_ns = scalar_us * 1000.0 / element_count;
+  const double batch_ns = batch_us * 1000.0 / element_count;
+
+  printer::Printer::Object batch_object(
+    printer(),
+    "batch_" | StringView(batch.name));
+  printer()
+    .key("type", batch.type)
+    .key("op", StringView(batch.op_str))
+    .key("width", NumberString(batch.width))
+    .key("scalarNs", NumberString(scalar_ns, "%0.3f"))
+    .key("batchNs", NumberString(batch_ns, "%0.3f"))
+    .key(
+      "speedup",
+      NumberString(batch_ns > 0.0 ? scalar_ns / batch_ns : 0.0, "%0.2fx"))
+    .key(
+      "mops",
+      NumberString(batch_ns > 0.0 ? 1000.0 / batch_ns : 0.0, "%0.1f"));
+
+  // the kernels must agree bit for bit with the scalar code
+  TEST_EXPECT(
+    View(batch_out.data(), batch_size * sizeof(operand_t))
+    == View(scalar_out.data(), batch_size * sizeof(operand_t)));
+
+  ResultArchive::record(
+    "mathtest.batch_" | StringView(batch.name) | ".ns",
+    batch_ns,
+    ResultArchive::IsHigherBetter::no);
+
+  return case_result();
+}
+
+u32 MathBench::measure_batch(
+  num_batch_op_t op,
+  bool is_scalar,
+  const Vector<operand_t> &a,
+  const Vector<operand_t> &b,
+  Vector<operand_t> &out) {
+  const u32 batch_size = a.count();
+  const u32 batch_count =
+    (m_options.iteration_count() + batch_size - 1) / batch_size;
+  u32 result = 0;
+  for (u32 i = 0; i < m_options.sample_count(); i++) {
+    ClockTimer timer(ClockTimer::IsRunning::yes);
+    for (u32 j = 0; j < batch_count; j++) {
+      if (is_scalar) {
+        num_test_execute_batch_scalar(
+          op,
+          a.data(),
+          b.data(),
+          out.data(),
+          batch_size);
+      } else {
+        num_test_execute_batch(op, a.data(), b.data(), out.data(), batch_size);
+      }
+    }
+    timer.stop();
+    result_sink = out.at(0).op_u64;
+
+    const u32 duration_us = timer.microseconds();
+    if (i == 0 || duration_us < result) {
+      result = duration_us;
+    }
+  }
+  return result;
+}
@@ -0,0 +1,49 @@
+#ifndef MATHBENCH_HPP
+#define MATHBENCH_HPP
+
+#include <sys/Cli.hpp>
+#include <test/Test.hpp>
+#include <var/Vector.hpp>
+
+#include "num_batch.h"
+#include "num_bench.h"
+
+class MathBench : public test::Test {
+public:
+  class Options {
+  public:
+    Options() = default;
+    explicit Options(const sys::Cli &cli);
+
+    // the fastest of sample_count loops of iteration_count operations is kept
+    API_AF(Options, u32, iteration_count, 1000000);
+    API_AF(Options, u32, sample_count, 3);
+
+    // elements per array handed to num_test_execute_batch()
+    API_AF(Options, u32, batch_size, 256);
+
+    // type and operator flags from num_test.h, entries match like the tests
+    API_AF(Options, u32, o_flags, 0);
+  };
+
+  MathBench(const var::StringView name, const Options &options);
+
+  bool execute_class_performance_case();
+
+private:
+  Options m_options;
+
+  bool execute_bench(const num_bench_t &bench);
+  // fastest ns per iteration of sample_count runs of the loop
+  double measure(num_bench_loop loop, const operand_t &a, const operand_t &b);
+
+  bool execute_batch(num_batch_op_t op);
+  u32 measure_batch(
+    num_batch_op_t op,
+    bool is_scalar,
+    const var::Vector<operand_t> &a,
+    const var::Vector<operand_t> &b,
+    var::Vector<operand_t> &out);
+};
+
+#endif // MATHBENCH_HPP
@@ -0,0 +1,157 @@
+#include <chrono.hpp>
+#include <thread.hpp>
+#include <var.hpp>
+
+#include "CliOption.hpp"
+#include "NumDiffTest.hpp"
+#include "WorkerPool.hpp"
+
+using namespace chrono;
+using namespace sys;
+using namespace test;
+using namespace thread;
+using namespace var;
+
+NumDiffTest::Options::Options(const Cli &cli) {
+  set_count(parse_u32_option(
+    cli,
+    "randomCount",
+    "random operand pairs per operation with --stress (default 1000000)",
+    count()));
+  set_seed(parse_u32_option(
+    cli,
+    "seed",
+    "seed for the random operands, reported with each failure (default 1)",
+    seed()));
+  set_thread_count(parse_u32_option(
+    cli,
+    "threads",
+    "threads sharing the random operands (default 4)",
+    thread_count()));
+}
+
+NumDiffTest::NumDiffTest(const StringView name, const Options &options)
+  : Test(name), m_options(options) {}
+
+bool NumDiffTest::execute_class_stress_case() {
+  TEST_ASSERT(m_options.thread_count() > 0);
+
+  printer()
+    .key("count", NumberString(m_options.count()))
+    .key("seed", NumberString(m_options.seed()))
+    .key("threads", NumberString(m_options.thread_count()));
+
+  const u32 o_flags = m_options.o_flags();
+  for (u32 idx = 0; idx < num_diff_count(); idx++) {
+    const num_diff_t *diff = num_diff_get(idx);
+    if ((diff->o_execute_flags & o_flags) == diff->o_execute_flags) {
+      TEST_EXPECT(execute_diff(*diff));
+    }
+  }
+
+  return case_result();
+}
+
+bool NumDiffTest::execute_diff(const num_diff_t &diff) {
+  struct Worker {
+    const num_diff_t *diff = nullptr;
+    u32 seed = 0;
+    u32 begin = 0;
+    u32 end = 0;
+    u32 failure_count = 0;
+    u32 first_failure = 0;
+  };
+
+  const u32 thread_count = m_options.thread_count();
+  Vector<Worker> workers;
+  workers.resize(thread_count);
+
+  WorkerPool pool(thread_count);
+  for (u32 i = 0; i < thread_count; i++) {
+    Worker &worker = workers.at(i);
+    worker.diff = &diff;
+    worker.seed = m_options.seed();
+    worker.begin = u32(u64(m_options.count()) * i / thread_count);
+    worker.end = u32(u64(m_options.count()) * (i + 1) / thread_count);
+    pool.add(&worker, [](void *args) -> void * {
+      auto *worker = reinterpret_cast<Worker *>(args);
+      for (u32 index = worker->begin; index < worker->end; index++) {
+        operand_t a;
+        operand_t b;
+        operand_t expected;
+        operand_t actual;
+        num_diff_generate(worker->diff, worker->seed, index, &a, &b);
+        if (num_diff_check(worker->diff, a, b, &expected, &actual) == 0) {
+          if (worker->failure_count++ == 0) {
+            worker->first_failure = index;
+          }
+        }
+      }
+      return nullptr;
+    });
+  }
+  ClockTimer timer(ClockTimer::IsRunning::yes);
+  pool.start();
+  TEST_EXPECT(pool.join());
+  timer.stop();
+  TEST_ASSERT(is_success());
+
+  // workers cover increasing index ranges so the first one with a failure
+  // has the lowest failing index
+  u32 failure_count = 0;
+  const Worker *first = nullptr;
+  for (const auto &worker : workers) {
+    failure_count += worker.failure_count;
+    if (first == nullptr && worker.failure_count) {
+      first = &worker;
+    }
+  }
+
+  printer::Printer::Object diff_object(printer(), diff.name);
+  printer()
+    .key("op", StringView(diff.op_str))
+    .key("duration", NumberString(timer.milliseconds(), "%ld ms"))
+    .key("failures", NumberString(failure_count));
+
+  if (first) {
+    print_reproducer(diff, first->first_failure);
+  }
+
+  TEST_EXPECT(failure_count == 0);
+  return case_result();
+}
+
+void NumDiffTest::print_reproducer(const num_diff_t &diff, u32 index) {
+  operand_t a;
+  operand_t b;
+  operand_t expected;
+  operand_t actual;
+  num_diff_generate(&diff, m_options.seed(), index, &a, &b);
+  num_diff_check(&diff, a, b, &expected, &actual);
+
+  printer::Printer::Object reproducer_object(printer(), "reproducer");
+  printer()
+    .key("seed", NumberString(m_options.seed()))
+    .key("index", NumberString(index))
+    .key("a", hex(a))
+    .key("b", hex(b))
+    .key("expected", hex(expected))
+    .key("actual", hex(actual));
+
+  num_diff_minimize(&diff, &a, &b);
+  num_diff_check(&diff, a, b, &expected, &actual);
+  printer()
+    .key("minimalA", hex(a))
+    .key("minimalB", hex(b))
+    .key("minimalExpected", hex(expected))
+    .key("minimalActual", hex(actual));
+}
+
+GeneralString NumDiffTest::hex(const operand_t &value) {
+  GeneralString result;
+  result.format(
+    "0x%08lx%08lx",
+    u32(value.op_u64 >> 32),
+    u32(value.op_u64));
+  return result;
+}
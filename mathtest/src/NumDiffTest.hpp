@@ -0,0 +1,39 @@
+#ifndef NUMDIFFTEST_HPP
+#define NUMDIFFTEST_HPP
+
+#include <sys/Cli.hpp>
+#include <test/Test.hpp>
+#include <var/StackString.hpp>
+
+#include "num_diff.h"
+
+class NumDiffTest : public test::Test {
+public:
+  class Options {
+  public:
+    Options() = default;
+    explicit Options(const sys::Cli &cli);
+
+    // random operand pairs per operation, split across the threads
+    API_AF(Options, u32, count, 1000000);
+    API_AF(Options, u32, seed, 1);
+    API_AF(Options, u32, thread_count, 4);
+
+    // type and operator flags from num_test.h, entries match like the tests
+    API_AF(Options, u32, o_flags, 0);
+  };
+
+  NumDiffTest(const var::StringView name, const Options &options);
+
+  bool execute_class_stress_case();
+
+private:
+  Options m_options;
+
+  bool execute_diff(const num_diff_t &diff);
+  void print_reproducer(const num_diff_t &diff, u32 index);
+
+  static var::GeneralString hex(const operand_t &value);
+};
+
+#endif // NUMDIFFTEST_HPP
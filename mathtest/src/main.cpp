@@ -1,5 +1,12 @@
 #include <stdio.h>
 
+#include "LibmTest.hpp"
+#include "MathBench.hpp"
+#include "NumDiffTest.hpp"
+#include "Repeat.hpp"
+#include "ResultArchive.hpp"
+#include "num_fixed.h"
+#include "num_libm.h"
 #include "num_test.h"
 #include "sl_config.h"
 #include <sys/Cli.hpp>
@@ -26,8 +33,13 @@ int main(int argc, char *argv[]) {
   }
 
   o_execute_flags = decode_cli(cli);
+  const u32 execution_flags = u32(Test::parse_execution_flags(cli));
+  // the table cases have always been selected with the execution flags
+  // included (their bits overlap the operator flags), the classes below get
+  // only the operator and type flags
+  const u32 o_table_flags = o_execute_flags | execution_flags;
 
-  if (o_execute_flags == 0) {
+  if (o_table_flags == 0) {
     printf("Nothing to test\n");
     return 1;
   }
@@ -35,39 +47,94 @@ int main(int argc, char *argv[]) {
   {
     auto scope = Test::Scope<printer::Printer>(
       Test::Initialize().set_git_hash(SOS_GIT_HASH).set_name("mathtest"));
+    ResultArchive::Scope archive_scope(
+      cli,
+      "mathtest",
+      SL_CONFIG_VERSION_STRING,
+      SOS_GIT_HASH);
 
     for (idx = 0; idx < num_test_count(); idx++) {
-      const test_t *test = num_test_get(idx);
-      if ((test->o_execute_flags & o_execute_flags) == test->o_execute_flags) {
+      test_t test;
+      num_test_get(idx, &test);
+      if ((test.o_execute_flags & o_table_flags) == test.o_execute_flags) {
         GeneralString name;
         name.format(
           "%d:%s: %s %s %s",
           idx,
-          test->name,
-          test->a_str,
-          test->op_str,
-          test->b_str);
+          test.name,
+          test.a_str,
+          test.op_str,
+          test.b_str);
 
         {
           printer::Printer::Object case_object(Test::printer(), name);
-          int result = test->operation(test->a, test->b, test->result);
+          int result = test.operation(test.a, test.b, test.result);
           Test::printer().key_bool("result", result != 0);
         }
       }
     }
+
+    // --q15/--q31 with the operator flags check the fixed-point kernels
+    for (idx = 0; idx < num_fixed_test_count(); idx++) {
+      const num_fixed_test_t *test = num_fixed_test_get(idx);
+      if ((test->o_execute_flags & o_table_flags) == test->o_execute_flags) {
+        GeneralString name;
+        name.format("%d:%s", idx, test->expression);
+
+        {
+          printer::Printer::Object case_object(Test::printer(), name);
+          int result = num_fixed_test_execute(test);
+          Test::printer().key_bool("result", result != 0);
+        }
+      }
+    }
+
+    const Repeat repeat(cli);
+
+    // --stress checks the matching operations against a software reference
+    // with random operands
+    if (execution_flags & u32(Test::ExecuteFlags::stress)) {
+      const auto options =
+        NumDiffTest::Options(cli).set_o_flags(o_execute_flags);
+      repeat.execute(
+        [&] { return NumDiffTest("differential", options); },
+        Test::ExecuteFlags::stress);
+    }
+
+    // --libm checks the accuracy of the float and/or double functions and
+    // with --performance times them
+    if (o_execute_flags & LIBM_TEST_FLAG) {
+      const auto options = LibmTest::Options(cli).set_o_flags(o_execute_flags);
+      repeat.execute(
+        [&] { return LibmTest("libm", options); },
+        Test::ExecuteFlags(
+          u32(Test::ExecuteFlags::api)
+          | (execution_flags & u32(Test::ExecuteFlags::performance))));
+    }
+
+    // --performance times the matching operations in throughput loops
+    if (execution_flags & u32(Test::ExecuteFlags::performance)) {
+      const auto options =
+        MathBench::Options(cli).set_o_flags(o_execute_flags);
+      repeat.execute(
+        [&] { return MathBench("throughput", options); },
+        Test::ExecuteFlags::performance);
+    }
   }
 
   return 0;
 }
 
 u32 decode_cli(const Cli &cli) {
-  auto execution_flags = Test::parse_execution_flags(cli);
   u32 o_flags = 0;
   o_flags |= Test::parse_test(cli, "comparison", COMPARISON_TEST_FLAG);
   o_flags |= Test::parse_test(cli, "arithmetic", ARITHMETIC_TEST_FLAG);
   o_flags |= Test::parse_test(cli, "logic", LOGICAL_TEST_FLAG);
   o_flags |= Test::parse_test(cli, "shift", SHIFT_TEST_FLAG);
   o_flags |= Test::parse_test(cli, "typecast", TYPE_CAST_TEST_FLAG);
+  o_flags |= Test::parse_test(cli, "libm", LIBM_TEST_FLAG);
+  o_flags |= Test::parse_test(cli, "q15", Q15_TEST_FLAG);
+  o_flags |= Test::parse_test(cli, "q31", Q31_TEST_FLAG);
   o_flags |= Test::parse_test(cli, "u8", U8_TEST_FLAG);
   o_flags |= Test::parse_test(cli, "u16", U16_TEST_FLAG);
   o_flags |= Test::parse_test(cli, "u32", U32_TEST_FLAG);
@@ -84,5 +151,5 @@ u32 decode_cli(const Cli &cli) {
                | S8_TEST_FLAG | S16_TEST_FLAG | S32_TEST_FLAG | S64_TEST_FLAG
                | FLOAT_TEST_FLAG | INT_TEST_FLAG;
   }
-  return o_flags | u32(execution_flags);
+  return o_flags;
 }
@@ -0,0 +1,369 @@
+#include <string.h>
+
+#include "num_batch.h"
+
+#if defined __AVX__
+#include <immintrin.h>
+#elif defined __SSE2__
+#include <emmintrin.h>
+#elif defined __ARM_NEON
+#include <arm_neon.h>
+#endif
+
+#if defined __AVX2__
+#define NUM_BATCH_ISA "avx2"
+#elif defined __AVX__
+#define NUM_BATCH_ISA "avx"
+#elif defined __SSE2__
+#define NUM_BATCH_ISA "sse2"
+#elif defined __ARM_NEON && defined __aarch64__
+#define NUM_BATCH_ISA "neon64"
+#elif defined __ARM_NEON
+#define NUM_BATCH_ISA "neon"
+#else
+#define NUM_BATCH_ISA "scalar"
+#endif
+
+// operand_t is 8 bytes so the 64-bit types sit contiguously in an array,
+// 32-bit types are in the low half of each element and are packed into
+// (and spread out of) full vectors by the kernels
+#define NUM_BATCH_SCALAR_FUNCTION(function_name, field, operation)             \
+  static operand_t function_name(operand_t a, operand_t b) {                   \
+    operand_t result;                                                          \
+    memset(&result, 0, sizeof(result));                                        \
+    result.field = a.field operation b.field;                                  \
+    return result;                                                             \
+  }
+
+NUM_BATCH_SCALAR_FUNCTION(add_u32, op_u32, +)
+NUM_BATCH_SCALAR_FUNCTION(sub_u32, op_u32, -)
+NUM_BATCH_SCALAR_FUNCTION(mul_u32, op_u32, *)
+NUM_BATCH_SCALAR_FUNCTION(add_u64, op_u64, +)
+NUM_BATCH_SCALAR_FUNCTION(sub_u64, op_u64, -)
+NUM_BATCH_SCALAR_FUNCTION(mul_u64, op_u64, *)
+NUM_BATCH_SCALAR_FUNCTION(add_s64, op_s64, +)
+NUM_BATCH_SCALAR_FUNCTION(sub_s64, op_s64, -)
+NUM_BATCH_SCALAR_FUNCTION(add_f, op_f, +)
+NUM_BATCH_SCALAR_FUNCTION(sub_f, op_f, -)
+NUM_BATCH_SCALAR_FUNCTION(mul_f, op_f, *)
+NUM_BATCH_SCALAR_FUNCTION(div_f, op_f, /)
+NUM_BATCH_SCALAR_FUNCTION(add_d, op_d, +)
+NUM_BATCH_SCALAR_FUNCTION(sub_d, op_d, -)
+NUM_BATCH_SCALAR_FUNCTION(mul_d, op_d, *)
+NUM_BATCH_SCALAR_FUNCTION(div_d, op_d, /)
+
+// each kernel handles whole vectors and returns how many elements it did
+#define NUM_BATCH_KERNEL(function_name)                                        \
+  static size_t function_name(const operand_t *a, const operand_t *b,          \
+                              operand_t *out, size_t n)
+
+#if defined __SSE2__
+
+#define NUM_BATCH_SSE_U32(function_name, intrinsic)                            \
+  NUM_BATCH_KERNEL(function_name) {                                            \
+    const __m128i mask = _mm_set_epi32(0, -1, 0, -1);                          \
+    size_t i;                                                                  \
+    for (i = 0; i + 2 <= n; i += 2) {                                          \
+      const __m128i x = _mm_loadu_si128((const __m128i *)(a + i));             \
+      const __m128i y = _mm_loadu_si128((const __m128i *)(b + i));             \
+      _mm_storeu_si128((__m128i *)(out + i),                                   \
+                       _mm_and_si128(intrinsic(x, y), mask));                  \
+    }                                                                          \
+    return i;                                                                  \
+  }
+
+// _mm_mul_epu32 multiplies the low halves, the mask keeps the low 32 bits
+NUM_BATCH_SSE_U32(batch_add_u32, _mm_add_epi32)
+NUM_BATCH_SSE_U32(batch_sub_u32, _mm_sub_epi32)
+NUM_BATCH_SSE_U32(batch_mul_u32, _mm_mul_epu32)
+#define NUM_BATCH_U32_WIDTH 2
+
+#if defined __AVX2__
+#define NUM_BATCH_AVX2_U64(function_name, intrinsic)                           \
+  NUM_BATCH_KERNEL(function_name) {                                            \
+    size_t i;                                                                  \
+    for (i = 0; i + 4 <= n; i += 4) {                                          \
+      const __m256i x = _mm256_loadu_si256((const __m256i *)(a + i));          \
+      const __m256i y = _mm256_loadu_si256((const __m256i *)(b + i));          \
+      _mm256_storeu_si256((__m256i *)(out + i), intrinsic(x, y));              \
+    }                                                                          \
+    return i;                                                                  \
+  }
+
+NUM_BATCH_AVX2_U64(batch_add_u64, _mm256_add_epi64)
+NUM_BATCH_AVX2_U64(batch_sub_u64, _mm256_sub_epi64)
+#define NUM_BATCH_U64_WIDTH 4
+#else
+#define NUM_BATCH_SSE_U64(function_name, intrinsic)                            \
+  NUM_BATCH_KERNEL(function_name) {                                            \
+    size_t i;                                                                  \
+    for (i = 0; i + 2 <= n; i += 2) {                                          \
+      const __m128i x = _mm_loadu_si128((const __m128i *)(a + i));             \
+      const __m128i y = _mm_loadu_si128((const __m128i *)(b + i));             \
+      _mm_storeu_si128((__m128i *)(out + i), intrinsic(x, y));                 \
+    }                                                                          \
+    return i;                                                                  \
+  }
+
+NUM_BATCH_SSE_U64(batch_add_u64, _mm_add_epi64)
+NUM_BATCH_SSE_U64(batch_sub_u64, _mm_sub_epi64)
+#define NUM_BATCH_U64_WIDTH 2
+#endif
+
+// four floats are packed out of the low halves of four elements
+#define NUM_BATCH_SSE_F(function_name, intrinsic)                              \
+  NUM_BATCH_KERNEL(function_name) {                                            \
+    const __m128 zero = _mm_setzero_ps();                                      \
+    size_t i;                                                                  \
+    for (i = 0; i + 4 <= n; i += 4) {                                          \
+      const __m128 x = _mm_shuffle_ps(_mm_loadu_ps(&a[i].op_f),                \
+                                      _mm_loadu_ps(&a[i + 2].op_f),            \
+                                      _MM_SHUFFLE(2, 0, 2, 0));                \
+      const __m128 y = _mm_shuffle_ps(_mm_loadu_ps(&b[i].op_f),                \
+                                      _mm_loadu_ps(&b[i + 2].op_f),            \
+                                      _MM_SHUFFLE(2, 0, 2, 0));                \
+      const __m128 result = intrinsic(x, y);                                   \
+      _mm_storeu_ps(&out[i].op_f, _mm_unpacklo_ps(result, zero));              \
+      _mm_storeu_ps(&out[i + 2].op_f, _mm_unpackhi_ps(result, zero));          \
+    }                                                                          \
+    return i;                                                                  \
+  }
+
+NUM_BATCH_SSE_F(batch_add_f, _mm_add_ps)
+NUM_BATCH_SSE_F(batch_sub_f, _mm_sub_ps)
+NUM_BATCH_SSE_F(batch_mul_f, _mm_mul_ps)
+NUM_BATCH_SSE_F(batch_div_f, _mm_div_ps)
+#define NUM_BATCH_F_WIDTH 4
+
+#if defined __AVX__
+#define NUM_BATCH_AVX_D(function_name, intrinsic)                              \
+  NUM_BATCH_KERNEL(function_name) {                                            \
+    size_t i;                                                                  \
+    for (i = 0; i + 4 <= n; i += 4) {                                          \
+      _mm256_storeu_pd(&out[i].op_d, intrinsic(_mm256_loadu_pd(&a[i].op_d),    \
+                                               _mm256_loadu_pd(&b[i].op_d)));  \
+    }                                                                          \
+    return i;                                                                  \
+  }
+
+NUM_BATCH_AVX_D(batch_add_d, _mm256_add_pd)
+NUM_BATCH_AVX_D(batch_sub_d, _mm256_sub_pd)
+NUM_BATCH_AVX_D(batch_mul_d, _mm256_mul_pd)
+NUM_BATCH_AVX_D(batch_div_d, _mm256_div_pd)
+#define NUM_BATCH_D_WIDTH 4
+#else
+#define NUM_BATCH_SSE_D(function_name, intrinsic)                              \
+  NUM_BATCH_KERNEL(function_name) {                                            \
+    size_t i;                                                                  \
+    for (i = 0; i + 2 <= n; i += 2) {                                          \
+      _mm_storeu_pd(&out[i].op_d,                                              \
+                    intrinsic(_mm_loadu_pd(&a[i].op_d),                        \
+                              _mm_loadu_pd(&b[i].op_d)));                      \
+    }                                                                          \
+    return i;                                                                  \
+  }
+
+NUM_BATCH_SSE_D(batch_add_d, _mm_add_pd)
+NUM_BATCH_SSE_D(batch_sub_d, _mm_sub_pd)
+NUM_BATCH_SSE_D(batch_mul_d, _mm_mul_pd)
+NUM_BATCH_SSE_D(batch_div_d, _mm_div_pd)
+#define NUM_BATCH_D_WIDTH 2
+#endif
+
+#elif defined __ARM_NEON
+
+// vld2/vst2 split the low and high halves of each element into two vectors
+#define NUM_BATCH_NEON_U32(function_name, intrinsic)                           \
+  NUM_BATCH_KERNEL(function_name) {                                            \
+    size_t i;                                                                  \
+    for (i = 0; i + 4 <= n; i += 4) {                                          \
+      const uint32x4x2_t x = vld2q_u32(&a[i].op_u32);                          \
+      const uint32x4x2_t y = vld2q_u32(&b[i].op_u32);                          \
+      uint32x4x2_t result;                                                     \
+      result.val[0] = intrinsic(x.val[0], y.val[0]);                           \
+      result.val[1] = vdupq_n_u32(0);                                          \
+      vst2q_u32(&out[i].op_u32, result);                                       \
+    }                                                                          \
+    return i;                                                                  \
+  }
+
+NUM_BATCH_NEON_U32(batch_add_u32, vaddq_u32)
+NUM_BATCH_NEON_U32(batch_sub_u32, vsubq_u32)
+NUM_BATCH_NEON_U32(batch_mul_u32, vmulq_u32)
+#define NUM_BATCH_U32_WIDTH 4
+
+#define NUM_BATCH_NEON_U64(function_name, intrinsic)                           \
+  NUM_BATCH_KERNEL(function_name) {                                            \
+    size_t i;                                                                  \
+    for (i = 0; i + 2 <= n; i += 2) {                                          \
+      vst1q_u64(&out[i].op_u64,                                                \
+                intrinsic(vld1q_u64(&a[i].op_u64), vld1q_u64(&b[i].op_u64)));  \
+    }                                                                          \
+    return i;                                                                  \
+  }
+
+NUM_BATCH_NEON_U64(batch_add_u64, vaddq_u64)
+NUM_BATCH_NEON_U64(batch_sub_u64, vsubq_u64)
+#define NUM_BATCH_U64_WIDTH 2
+
+#define NUM_BATCH_NEON_F(function_name, intrinsic)                             \
+  NUM_BATCH_KERNEL(function_name) {                                            \
+    size_t i;                                                                  \
+    for (i = 0; i + 4 <= n; i += 4) {                                          \
+      const float32x4x2_t x = vld2q_f32(&a[i].op_f);                           \
+      const float32x4x2_t y = vld2q_f32(&b[i].op_f);                           \
+      float32x4x2_t result;                                                    \
+      result.val[0] = intrinsic(x.val[0], y.val[0]);                           \
+      result.val[1] = vdupq_n_f32(0.0f);                                       \
+      vst2q_f32(&out[i].op_f, result);                                         \
+    }                                                                          \
+    return i;                                                                  \
+  }
+
+// 32-bit NEON flushes denormals to zero and has no divide, the float kernels
+// are only bit-identical to the scalar code on AArch64
+#if defined __aarch64__
+NUM_BATCH_NEON_F(batch_add_f, vaddq_f32)
+NUM_BATCH_NEON_F(batch_sub_f, vsubq_f32)
+NUM_BATCH_NEON_F(batch_mul_f, vmulq_f32)
+NUM_BATCH_NEON_F(batch_div_f, vdivq_f32)
+#define NUM_BATCH_F_WIDTH 4
+
+#define NUM_BATCH_NEON_D(function_name, intrinsic)                             \
+  NUM_BATCH_KERNEL(function_name) {                                            \
+    size_t i;                                                                  \
+    for (i = 0; i + 2 <= n; i += 2) {                                          \
+      vst1q_f64(&out[i].op_d,                                                  \
+                intrinsic(vld1q_f64(&a[i].op_d), vld1q_f64(&b[i].op_d)));      \
+    }                                                                          \
+    return i;                                                                  \
+  }
+
+NUM_BATCH_NEON_D(batch_add_d, vaddq_f64)
+NUM_BATCH_NEON_D(batch_sub_d, vsubq_f64)
+NUM_BATCH_NEON_D(batch_mul_d, vmulq_f64)
+NUM_BATCH_NEON_D(batch_div_d, vdivq_f64)
+#define NUM_BATCH_D_WIDTH 2
+#endif
+
+#endif
+
+// operations without a kernel leave all elements to the scalar loop
+#if !defined NUM_BATCH_U32_WIDTH
+#define batch_add_u32 0
+#define batch_sub_u32 0
+#define batch_mul_u32 0
+#define NUM_BATCH_U32_WIDTH 1
+#endif
+
+#if !defined NUM_BATCH_U64_WIDTH
+#define batch_add_u64 0
+#define batch_sub_u64 0
+#define NUM_BATCH_U64_WIDTH 1
+#endif
+
+#if !defined NUM_BATCH_F_WIDTH
+#define batch_add_f 0
+#define batch_sub_f 0
+#define batch_mul_f 0
+#define batch_div_f 0
+#define NUM_BATCH_F_WIDTH 1
+#endif
+
+#if !defined NUM_BATCH_D_WIDTH
+#define batch_add_d 0
+#define batch_sub_d 0
+#define batch_mul_d 0
+#define batch_div_d 0
+#define NUM_BATCH_D_WIDTH 1
+#endif
+
+typedef size_t (*num_batch_kernel)(const operand_t *a, const operand_t *b,
+                                   operand_t *out, size_t n);
+
+#define BATCH_CASE(o_execute_flags_value, function_name, type_name,            \
+                   operation_value, width_value)                               \
+  {                                                                            \
+    .name = #function_name, .type = type_name, .op_str = #operation_value,     \
+    .o_execute_flags = o_execute_flags_value, .scalar = function_name,         \
+    .width = width_value                                                       \
+  }
+
+// indexed by num_batch_op_t
+static const num_batch_t batches[NUM_BATCH_COUNT] = {
+    BATCH_CASE(U32_TEST_FLAG | ARITHMETIC_TEST_FLAG, add_u32, "u32", +,
+               NUM_BATCH_U32_WIDTH),
+    BATCH_CASE(U32_TEST_FLAG | ARITHMETIC_TEST_FLAG, sub_u32, "u32", -,
+               NUM_BATCH_U32_WIDTH),
+    BATCH_CASE(U32_TEST_FLAG | ARITHMETIC_TEST_FLAG, mul_u32, "u32", *,
+               NUM_BATCH_U32_WIDTH),
+    BATCH_CASE(U64_TEST_FLAG | ARITHMETIC_TEST_FLAG, add_u64, "u64", +,
+               NUM_BATCH_U64_WIDTH),
+    BATCH_CASE(U64_TEST_FLAG | ARITHMETIC_TEST_FLAG, sub_u64, "u64", -,
+               NUM_BATCH_U64_WIDTH),
+    BATCH_CASE(U64_TEST_FLAG | ARITHMETIC_TEST_FLAG, mul_u64, "u64", *, 1),
+    BATCH_CASE(S64_TEST_FLAG | ARITHMETIC_TEST_FLAG, add_s64, "s64", +,
+               NUM_BATCH_U64_WIDTH),
+    BATCH_CASE(S64_TEST_FLAG | ARITHMETIC_TEST_FLAG, sub_s64, "s64", -,
+               NUM_BATCH_U64_WIDTH),
+    BATCH_CASE(FLOAT_TEST_FLAG | ARITHMETIC_TEST_FLAG, add_f, "float", +,
+               NUM_BATCH_F_WIDTH),
+    BATCH_CASE(FLOAT_TEST_FLAG | ARITHMETIC_TEST_FLAG, sub_f, "float", -,
+               NUM_BATCH_F_WIDTH),
+    BATCH_CASE(FLOAT_TEST_FLAG | ARITHMETIC_TEST_FLAG, mul_f, "float", *,
+               NUM_BATCH_F_WIDTH),
+    BATCH_CASE(FLOAT_TEST_FLAG | ARITHMETIC_TEST_FLAG, div_f, "float", /,
+               NUM_BATCH_F_WIDTH),
+    BATCH_CASE(DOUBLE_TEST_FLAG | ARITHMETIC_TEST_FLAG, add_d, "double", +,
+               NUM_BATCH_D_WIDTH),
+    BATCH_CASE(DOUBLE_TEST_FLAG | ARITHMETIC_TEST_FLAG, sub_d, "double", -,
+               NUM_BATCH_D_WIDTH),
+    BATCH_CASE(DOUBLE_TEST_FLAG | ARITHMETIC_TEST_FLAG, mul_d, "double", *,
+               NUM_BATCH_D_WIDTH),
+    BATCH_CASE(DOUBLE_TEST_FLAG | ARITHMETIC_TEST_FLAG, div_d, "double", /,
+               NUM_BATCH_D_WIDTH)};
+
+// indexed by num_batch_op_t, null when the operation has no kernel
+static const num_batch_kernel kernels[NUM_BATCH_COUNT] = {
+    batch_add_u32, batch_sub_u32, batch_mul_u32, batch_add_u64,
+    batch_sub_u64, 0,             batch_add_u64, batch_sub_u64,
+    batch_add_f,   batch_sub_f,   batch_mul_f,   batch_div_f,
+    batch_add_d,   batch_sub_d,   batch_mul_d,   batch_div_d};
+
+void num_test_execute_batch(num_batch_op_t op, const operand_t *a,
+                            const operand_t *b, operand_t *out, size_t n) {
+  const num_batch_t *batch = num_batch_get(op);
+  const num_batch_kernel kernel = kernels[op];
+  size_t i = 0;
+  if (batch == 0) {
+    return;
+  }
+  if (kernel) {
+    i = kernel(a, b, out, n);
+  }
+  for (; i < n; i++) {
+    out[i] = batch->scalar(a[i], b[i]);
+  }
+}
+
+void num_test_execute_batch_scalar(num_batch_op_t op, const operand_t *a,
+                                   const operand_t *b, operand_t *out,
+                                   size_t n) {
+  const num_batch_t *batch = num_batch_get(op);
+  size_t i;
+  if (batch == 0) {
+    return;
+  }
+  for (i = 0; i < n; i++) {
+    out[i] = batch->scalar(a[i], b[i]);
+  }
+}
+
+const num_batch_t *num_batch_get(num_batch_op_t op) {
+  if ((u32)op < NUM_BATCH_COUNT) {
+    return batches + op;
+  }
+  return 0;
+}
+
+const char *num_batch_isa() { return NUM_BATCH_ISA; }
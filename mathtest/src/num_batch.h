@@ -0,0 +1,66 @@
+#ifndef NUM_BATCH_H
+#define NUM_BATCH_H
+
+#include <stddef.h>
+
+#include "num_test.h"
+
+// Batch evaluation of the num_test operations over arrays of operands.
+//
+// num_test_execute_batch() uses SIMD kernels where the target has them
+// (SSE2/AVX/AVX2 on x86, NEON on ARM) and finishes the elements that don't
+// fill a vector with scalar code. num_test_execute_batch_scalar() evaluates
+// one element per call through a function pointer the way the tests[] table
+// does. Both give bit-identical results, only the upper bytes of each result
+// operand beyond the operation's type are cleared.
+typedef enum {
+  NUM_BATCH_ADD_U32,
+  NUM_BATCH_SUB_U32,
+  NUM_BATCH_MUL_U32,
+  NUM_BATCH_ADD_U64,
+  NUM_BATCH_SUB_U64,
+  NUM_BATCH_MUL_U64,
+  NUM_BATCH_ADD_S64,
+  NUM_BATCH_SUB_S64,
+  NUM_BATCH_ADD_F,
+  NUM_BATCH_SUB_F,
+  NUM_BATCH_MUL_F,
+  NUM_BATCH_DIV_F,
+  NUM_BATCH_ADD_D,
+  NUM_BATCH_SUB_D,
+  NUM_BATCH_MUL_D,
+  NUM_BATCH_DIV_D,
+  NUM_BATCH_COUNT
+} num_batch_op_t;
+
+typedef operand_t (*num_batch_scalar)(operand_t a, operand_t b);
+
+typedef struct {
+  const char *name;
+  const char *type;
+  const char *op_str;
+  u32 o_execute_flags;
+  num_batch_scalar scalar;
+  // elements per SIMD iteration, 1 when the operation has no kernel
+  u32 width;
+} num_batch_t;
+
+#if defined __cplusplus
+extern "C" {
+#endif
+
+void num_test_execute_batch(num_batch_op_t op, const operand_t *a,
+                            const operand_t *b, operand_t *out, size_t n);
+void num_test_execute_batch_scalar(num_batch_op_t op, const operand_t *a,
+                                   const operand_t *b, operand_t *out,
+                                   size_t n);
+
+const num_batch_t *num_batch_get(num_batch_op_t op);
+// instruction set the kernels were built for
+const char *num_batch_isa();
+
+#if defined __cplusplus
+}
+#endif
+
+#endif // NUM_BATCH_H
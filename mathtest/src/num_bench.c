@@ -0,0 +1,417 @@
+#include <string.h>
+
+#include "num_bench.h"
+#include "num_fixed.h"
+
+// x steps in step_type, the unsigned type of a signed integer, so it wraps
+// instead of overflowing (undefined behavior) when the iteration count is
+// large. Converting back to the signed type is implementation defined (it
+// wraps on every target in use). Integers are folded with xor, floating point
+// with addition.
+#define NUM_BENCH_BINARY(function_name, type, field, step_type, fold, step,    \
+                         operation)                                            \
+  static operand_t function_name(operand_t a, operand_t b, u32 count) {        \
+    operand_t result;                                                          \
+    step_type x = (step_type)a.field;                                          \
+    const type y = b.field;                                                    \
+    type sum = 0;                                                              \
+    u32 i;                                                                     \
+    for (i = 0; i < count; i++) {                                              \
+      sum fold (type)((type)x operation y);                                    \
+      x += step;                                                               \
+    }                                                                          \
+    memset(&result, 0, sizeof(result));                                        \
+    result.field = sum;                                                        \
+    return result;                                                             \
+  }
+
+#define NUM_BENCH_CAST(function_name, type, field, step_type, result_type,     \
+                       result_field, fold, step)                               \
+  static operand_t function_name(operand_t a, operand_t b, u32 count) {        \
+    operand_t result;                                                          \
+    step_type x = (step_type)a.field;                                          \
+    result_type sum = 0;                                                       \
+    u32 i;                                                                     \
+    (void)b;                                                                   \
+    for (i = 0; i < count; i++) {                                              \
+      sum fold (result_type)(type)x;                                           \
+      x += step;                                                               \
+    }                                                                          \
+    memset(&result, 0, sizeof(result));                                        \
+    result.result_field = sum;                                                 \
+    return result;                                                             \
+  }
+
+// fixed-point loops, update computes the next sum from sum, x and y. x
+// steps in step_type like the integer loops so it wraps instead of
+// overflowing.
+#define NUM_BENCH_FIXED(function_name, type, field, step_type, step, update)   \
+  static operand_t function_name(operand_t a, operand_t b, u32 count) {        \
+    operand_t result;                                                          \
+    step_type position = (step_type)a.field;                                   \
+    const type y = b.field;                                                    \
+    type sum = 0;                                                              \
+    u32 i;                                                                     \
+    for (i = 0; i < count; i++) {                                              \
+      const type x = (type)position;                                           \
+      sum = (type)(update);                                                    \
+      position += step;                                                        \
+    }                                                                          \
+    memset(&result, 0, sizeof(result));                                        \
+    result.field = sum;                                                        \
+    return result;                                                             \
+  }
+
+// the stepping and folding of the loops without an operation
+#define NUM_BENCH_BASELINE(function_name, type, field, step_type, fold, step) \
+  NUM_BENCH_CAST(function_name, type, field, step_type, type, field, fold,    \
+                 step)
+
+NUM_BENCH_BASELINE(baseline_u8, u8, op_u8, u8, ^=, 7)
+NUM_BENCH_BASELINE(baseline_s8, i8, op_i8, u8, ^=, 7)
+NUM_BENCH_BASELINE(baseline_u16, u16, op_u16, u16, ^=, 7)
+NUM_BENCH_BASELINE(baseline_s16, s16, op_i16, u16, ^=, 7)
+NUM_BENCH_BASELINE(baseline_int, int, op_int, unsigned int, ^=, 7)
+NUM_BENCH_BASELINE(baseline_u32, u32, op_u32, u32, ^=, 7)
+NUM_BENCH_BASELINE(baseline_s32, s32, op_s32, u32, ^=, 7)
+NUM_BENCH_BASELINE(baseline_u64, u64, op_u64, u64, ^=, 7)
+NUM_BENCH_BASELINE(baseline_s64, s64, op_s64, u64, ^=, 7)
+NUM_BENCH_BASELINE(baseline_q15, q15_t, op_i16, u16, ^=, 7)
+NUM_BENCH_BASELINE(baseline_q31, q31_t, op_s32, u32, ^=, 7)
+NUM_BENCH_BASELINE(baseline_f, float, op_f, float, +=, 0.25f)
+NUM_BENCH_BASELINE(baseline_d, double, op_d, double, +=, 0.25)
+
+// Addition, subtraction and multiplication of signed integers are the same
+// two's complement instructions as for unsigned ones, those loops run in the
+// unsigned type so a wrapping result is defined. Division, modulus, shifts
+// and comparisons depend on the sign and run in the signed type. The narrow
+// types are promoted to int, their operands are small enough not to overflow
+// it.
+NUM_BENCH_BINARY(bench_add_u8, u8, op_u8, u8, ^=, 7, +)
+NUM_BENCH_BINARY(bench_mul_u8, u8, op_u8, u8, ^=, 7, *)
+NUM_BENCH_BINARY(bench_div_u8, u8, op_u8, u8, ^=, 7, /)
+NUM_BENCH_BINARY(bench_add_s8, u8, op_u8, u8, ^=, 7, +)
+NUM_BENCH_BINARY(bench_mul_s8, u8, op_u8, u8, ^=, 7, *)
+NUM_BENCH_BINARY(bench_div_s8, i8, op_i8, u8, ^=, 7, /)
+NUM_BENCH_BINARY(bench_add_u16, u16, op_u16, u16, ^=, 7, +)
+NUM_BENCH_BINARY(bench_mul_u16, u16, op_u16, u16, ^=, 7, *)
+NUM_BENCH_BINARY(bench_div_u16, u16, op_u16, u16, ^=, 7, /)
+NUM_BENCH_BINARY(bench_add_s16, u16, op_u16, u16, ^=, 7, +)
+NUM_BENCH_BINARY(bench_mul_s16, u16, op_u16, u16, ^=, 7, *)
+NUM_BENCH_BINARY(bench_div_s16, s16, op_i16, u16, ^=, 7, /)
+NUM_BENCH_BINARY(bench_add_int, unsigned int, op_int, unsigned int, ^=, 7, +)
+NUM_BENCH_BINARY(bench_mul_int, unsigned int, op_int, unsigned int, ^=, 7, *)
+NUM_BENCH_BINARY(bench_div_int, int, op_int, unsigned int, ^=, 7, /)
+NUM_BENCH_BINARY(bench_modulus_int, int, op_int, unsigned int, ^=, 7, %)
+NUM_BENCH_BINARY(bench_add_u32, u32, op_u32, u32, ^=, 7, +)
+NUM_BENCH_BINARY(bench_sub_u32, u32, op_u32, u32, ^=, 7, -)
+NUM_BENCH_BINARY(bench_mul_u32, u32, op_u32, u32, ^=, 7, *)
+NUM_BENCH_BINARY(bench_div_u32, u32, op_u32, u32, ^=, 7, /)
+NUM_BENCH_BINARY(bench_modulus_u32, u32, op_u32, u32, ^=, 7, %)
+NUM_BENCH_BINARY(bench_add_s32, u32, op_u32, u32, ^=, 7, +)
+NUM_BENCH_BINARY(bench_sub_s32, u32, op_u32, u32, ^=, 7, -)
+NUM_BENCH_BINARY(bench_mul_s32, u32, op_u32, u32, ^=, 7, *)
+NUM_BENCH_BINARY(bench_div_s32, s32, op_s32, u32, ^=, 7, /)
+NUM_BENCH_BINARY(bench_modulus_s32, s32, op_s32, u32, ^=, 7, %)
+NUM_BENCH_BINARY(bench_add_u64, u64, op_u64, u64, ^=, 7, +)
+NUM_BENCH_BINARY(bench_sub_u64, u64, op_u64, u64, ^=, 7, -)
+NUM_BENCH_BINARY(bench_mul_u64, u64, op_u64, u64, ^=, 7, *)
+NUM_BENCH_BINARY(bench_div_u64, u64, op_u64, u64, ^=, 7, /)
+NUM_BENCH_BINARY(bench_modulus_u64, u64, op_u64, u64, ^=, 7, %)
+NUM_BENCH_BINARY(bench_add_s64, u64, op_u64, u64, ^=, 7, +)
+NUM_BENCH_BINARY(bench_sub_s64, u64, op_u64, u64, ^=, 7, -)
+NUM_BENCH_BINARY(bench_mul_s64, u64, op_u64, u64, ^=, 7, *)
+NUM_BENCH_BINARY(bench_div_s64, s64, op_s64, u64, ^=, 7, /)
+NUM_BENCH_BINARY(bench_modulus_s64, s64, op_s64, u64, ^=, 7, %)
+NUM_BENCH_BINARY(bench_add_f, float, op_f, float, +=, 0.25f, +)
+NUM_BENCH_BINARY(bench_sub_f, float, op_f, float, +=, 0.25f, -)
+NUM_BENCH_BINARY(bench_mul_f, float, op_f, float, +=, 0.25f, *)
+NUM_BENCH_BINARY(bench_div_f, float, op_f, float, +=, 0.25f, /)
+NUM_BENCH_BINARY(bench_add_d, double, op_d, double, +=, 0.25, +)
+NUM_BENCH_BINARY(bench_sub_d, double, op_d, double, +=, 0.25, -)
+NUM_BENCH_BINARY(bench_mul_d, double, op_d, double, +=, 0.25, *)
+NUM_BENCH_BINARY(bench_div_d, double, op_d, double, +=, 0.25, /)
+
+// the other comparisons compile to the same compare and conditional
+NUM_BENCH_BINARY(bench_cmp_u32, u32, op_u32, u32, ^=, 7, ==)
+NUM_BENCH_BINARY(bench_lessthan_u32, u32, op_u32, u32, ^=, 7, <)
+NUM_BENCH_BINARY(bench_cmp_s32, s32, op_s32, u32, ^=, 7, ==)
+NUM_BENCH_BINARY(bench_lessthan_s32, s32, op_s32, u32, ^=, 7, <)
+NUM_BENCH_BINARY(bench_cmp_u64, u64, op_u64, u64, ^=, 7, ==)
+NUM_BENCH_BINARY(bench_lessthan_u64, u64, op_u64, u64, ^=, 7, <)
+NUM_BENCH_BINARY(bench_cmp_s64, s64, op_s64, u64, ^=, 7, ==)
+NUM_BENCH_BINARY(bench_lessthan_s64, s64, op_s64, u64, ^=, 7, <)
+NUM_BENCH_BINARY(bench_cmp_f, float, op_f, float, +=, 0.25f, ==)
+NUM_BENCH_BINARY(bench_lessthan_f, float, op_f, float, +=, 0.25f, <)
+NUM_BENCH_BINARY(bench_cmp_d, double, op_d, double, +=, 0.25, ==)
+NUM_BENCH_BINARY(bench_lessthan_d, double, op_d, double, +=, 0.25, <)
+
+// signed values are only shifted right, left shifts of negative values are
+// undefined
+NUM_BENCH_BINARY(bench_shift_to_left_u32, u32, op_u32, u32, ^=, 7, <<)
+NUM_BENCH_BINARY(bench_shift_to_right_u32, u32, op_u32, u32, ^=, 7, >>)
+NUM_BENCH_BINARY(bench_shift_to_right_s32, s32, op_s32, u32, ^=, 7, >>)
+NUM_BENCH_BINARY(bench_shift_to_left_u64, u64, op_u64, u64, ^=, 7, <<)
+NUM_BENCH_BINARY(bench_shift_to_right_u64, u64, op_u64, u64, ^=, 7, >>)
+NUM_BENCH_BINARY(bench_shift_to_right_s64, s64, op_s64, u64, ^=, 7, >>)
+
+// xor results are folded with addition, folding them with xor would let the
+// compiler move y out of the loop
+NUM_BENCH_BINARY(bench_and_u32, u32, op_u32, u32, ^=, 7, &)
+NUM_BENCH_BINARY(bench_or_u32, u32, op_u32, u32, ^=, 7, |)
+NUM_BENCH_BINARY(bench_xor_u32, u32, op_u32, u32, +=, 7, ^)
+NUM_BENCH_BINARY(bench_and_u64, u64, op_u64, u64, ^=, 7, &)
+NUM_BENCH_BINARY(bench_or_u64, u64, op_u64, u64, ^=, 7, |)
+NUM_BENCH_BINARY(bench_xor_u64, u64, op_u64, u64, +=, 7, ^)
+
+NUM_BENCH_CAST(bench_f_to_s32, float, op_f, float, s32, op_s32, ^=, 0.25f)
+NUM_BENCH_CAST(bench_f_to_u32, float, op_f, float, u32, op_u32, ^=, 0.25f)
+NUM_BENCH_CAST(bench_f_to_s64, float, op_f, float, s64, op_s64, ^=, 0.25f)
+NUM_BENCH_CAST(bench_f_to_u64, float, op_f, float, u64, op_u64, ^=, 0.25f)
+NUM_BENCH_CAST(bench_s32_to_f, s32, op_s32, u32, float, op_f, +=, 7)
+NUM_BENCH_CAST(bench_u32_to_f, u32, op_u32, u32, float, op_f, +=, 7)
+NUM_BENCH_CAST(bench_s64_to_f, s64, op_s64, u64, float, op_f, +=, 7)
+NUM_BENCH_CAST(bench_u64_to_f, u64, op_u64, u64, float, op_f, +=, 7)
+NUM_BENCH_CAST(bench_d_to_s32, double, op_d, double, s32, op_s32, ^=, 0.25)
+NUM_BENCH_CAST(bench_d_to_u32, double, op_d, double, u32, op_u32, ^=, 0.25)
+NUM_BENCH_CAST(bench_d_to_s64, double, op_d, double, s64, op_s64, ^=, 0.25)
+NUM_BENCH_CAST(bench_d_to_u64, double, op_d, double, u64, op_u64, ^=, 0.25)
+NUM_BENCH_CAST(bench_s32_to_d, s32, op_s32, u32, double, op_d, +=, 7)
+NUM_BENCH_CAST(bench_u32_to_d, u32, op_u32, u32, double, op_d, +=, 7)
+NUM_BENCH_CAST(bench_s64_to_d, s64, op_s64, u64, double, op_d, +=, 7)
+NUM_BENCH_CAST(bench_u64_to_d, u64, op_u64, u64, double, op_d, +=, 7)
+
+NUM_BENCH_FIXED(bench_add_q15, q15_t, op_i16, u16, 7, sum ^ q15_add(x, y))
+NUM_BENCH_FIXED(bench_mul_q15, q15_t, op_i16, u16, 7, sum ^ q15_mul(x, y))
+NUM_BENCH_FIXED(bench_mac_q15, q15_t, op_i16, u16, 7, q15_mac(sum, x, y))
+NUM_BENCH_FIXED(bench_add_q31, q31_t, op_s32, u32, 7, sum ^ q31_add(x, y))
+NUM_BENCH_FIXED(bench_mul_q31, q31_t, op_s32, u32, 7, sum ^ q31_mul(x, y))
+NUM_BENCH_FIXED(bench_mac_q31, q31_t, op_s32, u32, 7, q31_mac(sum, x, y))
+
+#define BENCH_CASE(o_execute_flags_value, function_name, type_name, op_type,   \
+                   a_value, b_value, operation_value, baseline_name)           \
+  {                                                                            \
+    .name = #function_name, .type = type_name, .op_str = #operation_value,     \
+    .o_execute_flags = o_execute_flags_value, .a.op_type = a_value,            \
+    .b.op_type = b_value, .loop = bench_##function_name,                       \
+    .baseline = baseline_name                                                  \
+  }
+
+#define BENCH_CASE_CAST(o_execute_flags_value, function_name, type_name,       \
+                        op_type, a_value, baseline_name)                       \
+  {                                                                            \
+    .name = #function_name, .type = type_name, .op_str = " cast ",             \
+    .o_execute_flags = o_execute_flags_value, .a.op_type = a_value,            \
+    .b.op_int = 0, .loop = bench_##function_name, .baseline = baseline_name    \
+  }
+
+// the float loops accumulate with +=, so bench_mul_f is also the float mac
+#define BENCH_CASE_FIXED(o_execute_flags_value, function_name, type_name,      \
+                         op_type, a_value, b_value, operation_value,           \
+                         baseline_name, float_function_name, float_a_value,    \
+                         float_b_value)                                        \
+  {                                                                            \
+    .name = #function_name, .type = type_name, .op_str = #operation_value,     \
+    .o_execute_flags = o_execute_flags_value, .a.op_type = a_value,            \
+    .b.op_type = b_value, .loop = bench_##function_name,                       \
+    .baseline = baseline_name, .float_loop = bench_##float_function_name,      \
+    .float_baseline = baseline_f, .float_a.op_f = float_a_value,               \
+    .float_b.op_f = float_b_value                                              \
+  }
+
+static const num_bench_t benches[] = {
+    BENCH_CASE(U8_TEST_FLAG | ARITHMETIC_TEST_FLAG, add_u8, "u8", op_u8,
+               0x12, 0x34, +, baseline_u8),
+    BENCH_CASE(U8_TEST_FLAG | ARITHMETIC_TEST_FLAG, mul_u8, "u8", op_u8,
+               0x12, 0x34, *, baseline_u8),
+    BENCH_CASE(U8_TEST_FLAG | ARITHMETIC_TEST_FLAG, div_u8, "u8", op_u8,
+               0xfe, 0x12, /, baseline_u8),
+    BENCH_CASE(S8_TEST_FLAG | ARITHMETIC_TEST_FLAG, add_s8, "s8", op_i8,
+               -0x12, 0x34, +, baseline_u8),
+    BENCH_CASE(S8_TEST_FLAG | ARITHMETIC_TEST_FLAG, mul_s8, "s8", op_i8,
+               -0x12, 0x34, *, baseline_u8),
+    BENCH_CASE(S8_TEST_FLAG | ARITHMETIC_TEST_FLAG, div_s8, "s8", op_i8,
+               -0x7e, 0x12, /, baseline_s8),
+    BENCH_CASE(U16_TEST_FLAG | ARITHMETIC_TEST_FLAG, add_u16, "u16", op_u16,
+               0x1234, 0x2345, +, baseline_u16),
+    BENCH_CASE(U16_TEST_FLAG | ARITHMETIC_TEST_FLAG, mul_u16, "u16", op_u16,
+               0x1234, 0x2345, *, baseline_u16),
+    BENCH_CASE(U16_TEST_FLAG | ARITHMETIC_TEST_FLAG, div_u16, "u16", op_u16,
+               0xfedc, 0x123, /, baseline_u16),
+    BENCH_CASE(S16_TEST_FLAG | ARITHMETIC_TEST_FLAG, add_s16, "s16", op_i16,
+               -0x1234, 0x2345, +, baseline_u16),
+    BENCH_CASE(S16_TEST_FLAG | ARITHMETIC_TEST_FLAG, mul_s16, "s16", op_i16,
+               -0x1234, 0x2345, *, baseline_u16),
+    BENCH_CASE(S16_TEST_FLAG | ARITHMETIC_TEST_FLAG, div_s16, "s16", op_i16,
+               -0x7edc, 0x123, /, baseline_s16),
+    BENCH_CASE(INT_TEST_FLAG | ARITHMETIC_TEST_FLAG, add_int, "int", op_int,
+               -0x1234567, 0x2345678, +, baseline_int),
+    BENCH_CASE(INT_TEST_FLAG | ARITHMETIC_TEST_FLAG, mul_int, "int", op_int,
+               -0x1234567, 0x9876, *, baseline_int),
+    BENCH_CASE(INT_TEST_FLAG | ARITHMETIC_TEST_FLAG, div_int, "int", op_int,
+               -0x7654321, 0x1234, /, baseline_int),
+    BENCH_CASE(INT_TEST_FLAG | ARITHMETIC_TEST_FLAG, modulus_int, "int", op_int,
+               -0x7654321, 0x1234, %, baseline_int),
+    BENCH_CASE(U32_TEST_FLAG | ARITHMETIC_TEST_FLAG, add_u32, "u32", op_u32,
+               0x12345678UL, 0x9876UL, +, baseline_u32),
+    BENCH_CASE(U32_TEST_FLAG | ARITHMETIC_TEST_FLAG, sub_u32, "u32", op_u32,
+               0x12345678UL, 0x9876UL, -, baseline_u32),
+    BENCH_CASE(U32_TEST_FLAG | ARITHMETIC_TEST_FLAG, mul_u32, "u32", op_u32,
+               0x12345678UL, 0x9876UL, *, baseline_u32),
+    BENCH_CASE(U32_TEST_FLAG | ARITHMETIC_TEST_FLAG, div_u32, "u32", op_u32,
+               0xfedcba98UL, 0x1234UL, /, baseline_u32),
+    BENCH_CASE(U32_TEST_FLAG | ARITHMETIC_TEST_FLAG, modulus_u32, "u32", op_u32,
+               0xfedcba98UL, 0x1234UL, %, baseline_u32),
+    BENCH_CASE(S32_TEST_FLAG | ARITHMETIC_TEST_FLAG, add_s32, "s32", op_s32,
+               -0x1234567L, 0x2345678L, +, baseline_u32),
+    BENCH_CASE(S32_TEST_FLAG | ARITHMETIC_TEST_FLAG, sub_s32, "s32", op_s32,
+               -0x1234567L, 0x2345678L, -, baseline_u32),
+    BENCH_CASE(S32_TEST_FLAG | ARITHMETIC_TEST_FLAG, mul_s32, "s32", op_s32,
+               -0x1234567L, 0x9876L, *, baseline_u32),
+    BENCH_CASE(S32_TEST_FLAG | ARITHMETIC_TEST_FLAG, div_s32, "s32", op_s32,
+               -0x7654321L, 0x1234L, /, baseline_s32),
+    BENCH_CASE(S32_TEST_FLAG | ARITHMETIC_TEST_FLAG, modulus_s32, "s32", op_s32,
+               -0x7654321L, 0x1234L, %, baseline_s32),
+    BENCH_CASE(U64_TEST_FLAG | ARITHMETIC_TEST_FLAG, add_u64, "u64", op_u64,
+               0x123456789ULL, 0x9876543210ULL, +, baseline_u64),
+    BENCH_CASE(U64_TEST_FLAG | ARITHMETIC_TEST_FLAG, sub_u64, "u64", op_u64,
+               0x123456789ULL, 0x9876543210ULL, -, baseline_u64),
+    BENCH_CASE(U64_TEST_FLAG | ARITHMETIC_TEST_FLAG, mul_u64, "u64", op_u64,
+               0x123456789ULL, 0x9876543210ULL, *, baseline_u64),
+    BENCH_CASE(U64_TEST_FLAG | ARITHMETIC_TEST_FLAG, div_u64, "u64", op_u64,
+               0xfedcba9876543210ULL, 0x123456789ULL, /, baseline_u64),
+    BENCH_CASE(U64_TEST_FLAG | ARITHMETIC_TEST_FLAG, modulus_u64, "u64", op_u64,
+               0xfedcba9876543210ULL, 0x123456789ULL, %, baseline_u64),
+    BENCH_CASE(S64_TEST_FLAG | ARITHMETIC_TEST_FLAG, add_s64, "s64", op_s64,
+               -0x123456789LL, 0x9876543210LL, +, baseline_s64),
+    BENCH_CASE(S64_TEST_FLAG | ARITHMETIC_TEST_FLAG, sub_s64, "s64", op_s64,
+               -0x123456789LL, 0x9876543210LL, -, baseline_s64),
+    BENCH_CASE(S64_TEST_FLAG | ARITHMETIC_TEST_FLAG, mul_s64, "s64", op_s64,
+               -0x123456789LL, 0x98765LL, *, baseline_s64),
+    BENCH_CASE(S64_TEST_FLAG | ARITHMETIC_TEST_FLAG, div_s64, "s64", op_s64,
+               -0x7edcba9876543210LL, 0x123456789LL, /, baseline_s64),
+    BENCH_CASE(S64_TEST_FLAG | ARITHMETIC_TEST_FLAG, modulus_s64, "s64", op_s64,
+               -0x7edcba9876543210LL, 0x123456789LL, %, baseline_s64),
+    BENCH_CASE(FLOAT_TEST_FLAG | ARITHMETIC_TEST_FLAG, add_f, "float", op_f,
+               1.5f, 3.25f, +, baseline_f),
+    BENCH_CASE(FLOAT_TEST_FLAG | ARITHMETIC_TEST_FLAG, sub_f, "float", op_f,
+               1.5f, 3.25f, -, baseline_f),
+    BENCH_CASE(FLOAT_TEST_FLAG | ARITHMETIC_TEST_FLAG, mul_f, "float", op_f,
+               1.5f, 1.0001f, *, baseline_f),
+    BENCH_CASE(FLOAT_TEST_FLAG | ARITHMETIC_TEST_FLAG, div_f, "float", op_f,
+               1.5f, 3.25f, /, baseline_f),
+    BENCH_CASE(DOUBLE_TEST_FLAG | ARITHMETIC_TEST_FLAG, add_d, "double", op_d,
+               1.5, 3.25, +, baseline_d),
+    BENCH_CASE(DOUBLE_TEST_FLAG | ARITHMETIC_TEST_FLAG, sub_d, "double", op_d,
+               1.5, 3.25, -, baseline_d),
+    BENCH_CASE(DOUBLE_TEST_FLAG | ARITHMETIC_TEST_FLAG, mul_d, "double", op_d,
+               1.5, 1.0001, *, baseline_d),
+    BENCH_CASE(DOUBLE_TEST_FLAG | ARITHMETIC_TEST_FLAG, div_d, "double", op_d,
+               1.5, 3.25, /, baseline_d),
+    BENCH_CASE(U32_TEST_FLAG | COMPARISON_TEST_FLAG, cmp_u32, "u32", op_u32,
+               0x12345678UL, 0x23456789UL, ==, baseline_u32),
+    BENCH_CASE(U32_TEST_FLAG | COMPARISON_TEST_FLAG, lessthan_u32, "u32",
+               op_u32, 0x12345678UL, 0x23456789UL, <, baseline_u32),
+    BENCH_CASE(S32_TEST_FLAG | COMPARISON_TEST_FLAG, cmp_s32, "s32", op_s32,
+               -0x1234567L, 0x2345678L, ==, baseline_s32),
+    BENCH_CASE(S32_TEST_FLAG | COMPARISON_TEST_FLAG, lessthan_s32, "s32",
+               op_s32, -0x1234567L, 0x2345678L, <, baseline_s32),
+    BENCH_CASE(U64_TEST_FLAG | COMPARISON_TEST_FLAG, cmp_u64, "u64", op_u64,
+               0x123456789ULL, 0x9876543210ULL, ==, baseline_u64),
+    BENCH_CASE(U64_TEST_FLAG | COMPARISON_TEST_FLAG, lessthan_u64, "u64",
+               op_u64, 0x123456789ULL, 0x9876543210ULL, <, baseline_u64),
+    BENCH_CASE(S64_TEST_FLAG | COMPARISON_TEST_FLAG, cmp_s64, "s64", op_s64,
+               -0x123456789LL, 0x9876543210LL, ==, baseline_s64),
+    BENCH_CASE(S64_TEST_FLAG | COMPARISON_TEST_FLAG, lessthan_s64, "s64",
+               op_s64, -0x123456789LL, 0x9876543210LL, <, baseline_s64),
+    BENCH_CASE(FLOAT_TEST_FLAG | COMPARISON_TEST_FLAG, cmp_f, "float", op_f,
+               1.5f, 3.25f, ==, baseline_f),
+    BENCH_CASE(FLOAT_TEST_FLAG | COMPARISON_TEST_FLAG, lessthan_f, "float",
+               op_f, 1.5f, 3.25f, <, baseline_f),
+    BENCH_CASE(DOUBLE_TEST_FLAG | COMPARISON_TEST_FLAG, cmp_d, "double", op_d,
+               1.5, 3.25, ==, baseline_d),
+    BENCH_CASE(DOUBLE_TEST_FLAG | COMPARISON_TEST_FLAG, lessthan_d, "double",
+               op_d, 1.5, 3.25, <, baseline_d),
+    BENCH_CASE(U32_TEST_FLAG | SHIFT_TEST_FLAG, shift_to_left_u32, "u32",
+               op_u32, 0x12345678UL, 5, <<, baseline_u32),
+    BENCH_CASE(U32_TEST_FLAG | SHIFT_TEST_FLAG, shift_to_right_u32, "u32",
+               op_u32, 0x12345678UL, 5, >>, baseline_u32),
+    BENCH_CASE(S32_TEST_FLAG | SHIFT_TEST_FLAG, shift_to_right_s32, "s32",
+               op_s32, -0x1234567L, 5, >>, baseline_s32),
+    BENCH_CASE(U64_TEST_FLAG | SHIFT_TEST_FLAG, shift_to_left_u64, "u64",
+               op_u64, 0x123456789ULL, 5, <<, baseline_u64),
+    BENCH_CASE(U64_TEST_FLAG | SHIFT_TEST_FLAG, shift_to_right_u64, "u64",
+               op_u64, 0x123456789ULL, 5, >>, baseline_u64),
+    BENCH_CASE(S64_TEST_FLAG | SHIFT_TEST_FLAG, shift_to_right_s64, "s64",
+               op_s64, -0x123456789LL, 5, >>, baseline_s64),
+    BENCH_CASE(U32_TEST_FLAG | LOGICAL_TEST_FLAG, and_u32, "u32", op_u32,
+               0x12345678UL, 0x0ff00ff0UL, &, baseline_u32),
+    BENCH_CASE(U32_TEST_FLAG | LOGICAL_TEST_FLAG, or_u32, "u32", op_u32,
+               0x12345678UL, 0x0ff00ff0UL, |, baseline_u32),
+    BENCH_CASE(U32_TEST_FLAG | LOGICAL_TEST_FLAG, xor_u32, "u32", op_u32,
+               0x12345678UL, 0x0ff00ff0UL, ^, baseline_u32),
+    BENCH_CASE(U64_TEST_FLAG | LOGICAL_TEST_FLAG, and_u64, "u64", op_u64,
+               0x123456789ULL, 0x0ff00ff00ff0ULL, &, baseline_u64),
+    BENCH_CASE(U64_TEST_FLAG | LOGICAL_TEST_FLAG, or_u64, "u64", op_u64,
+               0x123456789ULL, 0x0ff00ff00ff0ULL, |, baseline_u64),
+    BENCH_CASE(U64_TEST_FLAG | LOGICAL_TEST_FLAG, xor_u64, "u64", op_u64,
+               0x123456789ULL, 0x0ff00ff00ff0ULL, ^, baseline_u64),
+    BENCH_CASE_CAST(TYPE_CAST_TEST_FLAG | FLOAT_TEST_FLAG, f_to_s32,
+                    "float", op_f, -1000.5f, baseline_f),
+    BENCH_CASE_CAST(TYPE_CAST_TEST_FLAG | FLOAT_TEST_FLAG, f_to_u32,
+                    "float", op_f, 1000.5f, baseline_f),
+    BENCH_CASE_CAST(TYPE_CAST_TEST_FLAG | FLOAT_TEST_FLAG, f_to_s64,
+                    "float", op_f, -1000.5f, baseline_f),
+    BENCH_CASE_CAST(TYPE_CAST_TEST_FLAG | FLOAT_TEST_FLAG, f_to_u64,
+                    "float", op_f, 1000.5f, baseline_f),
+    BENCH_CASE_CAST(TYPE_CAST_TEST_FLAG | FLOAT_TEST_FLAG, s32_to_f,
+                    "s32", op_s32, -123456L, baseline_s32),
+    BENCH_CASE_CAST(TYPE_CAST_TEST_FLAG | FLOAT_TEST_FLAG, u32_to_f,
+                    "u32", op_u32, 123456UL, baseline_u32),
+    BENCH_CASE_CAST(TYPE_CAST_TEST_FLAG | FLOAT_TEST_FLAG, s64_to_f,
+                    "s64", op_s64, -0x123456789LL, baseline_s64),
+    BENCH_CASE_CAST(TYPE_CAST_TEST_FLAG | FLOAT_TEST_FLAG, u64_to_f,
+                    "u64", op_u64, 0x123456789ULL, baseline_u64),
+    BENCH_CASE_CAST(TYPE_CAST_TEST_FLAG | DOUBLE_TEST_FLAG, d_to_s32,
+                    "double", op_d, -1000.5, baseline_d),
+    BENCH_CASE_CAST(TYPE_CAST_TEST_FLAG | DOUBLE_TEST_FLAG, d_to_u32,
+                    "double", op_d, 1000.5, baseline_d),
+    BENCH_CASE_CAST(TYPE_CAST_TEST_FLAG | DOUBLE_TEST_FLAG, d_to_s64,
+                    "double", op_d, -1000.5, baseline_d),
+    BENCH_CASE_CAST(TYPE_CAST_TEST_FLAG | DOUBLE_TEST_FLAG, d_to_u64,
+                    "double", op_d, 1000.5, baseline_d),
+    BENCH_CASE_CAST(TYPE_CAST_TEST_FLAG | DOUBLE_TEST_FLAG, s32_to_d,
+                    "s32", op_s32, -123456L, baseline_s32),
+    BENCH_CASE_CAST(TYPE_CAST_TEST_FLAG | DOUBLE_TEST_FLAG, u32_to_d,
+                    "u32", op_u32, 123456UL, baseline_u32),
+    BENCH_CASE_CAST(TYPE_CAST_TEST_FLAG | DOUBLE_TEST_FLAG, s64_to_d,
+                    "s64", op_s64, -0x123456789LL, baseline_s64),
+    BENCH_CASE_CAST(TYPE_CAST_TEST_FLAG | DOUBLE_TEST_FLAG, u64_to_d,
+                    "u64", op_u64, 0x123456789ULL, baseline_u64),
+    BENCH_CASE_FIXED(Q15_TEST_FLAG | ARITHMETIC_TEST_FLAG, add_q15, "q15",
+                     op_i16, 0x1234, 0x2345, +, baseline_q15, add_f, 0.142f,
+                     0.276f),
+    BENCH_CASE_FIXED(Q15_TEST_FLAG | ARITHMETIC_TEST_FLAG, mul_q15, "q15",
+                     op_i16, 0x1234, 0x2345, *, baseline_q15, mul_f, 0.142f,
+                     0.276f),
+    BENCH_CASE_FIXED(Q15_TEST_FLAG | ARITHMETIC_TEST_FLAG, mac_q15, "q15",
+                     op_i16, 0x1234, 0x2345, mac, baseline_q15, mul_f, 0.142f,
+                     0.276f),
+    BENCH_CASE_FIXED(Q31_TEST_FLAG | ARITHMETIC_TEST_FLAG, add_q31, "q31",
+                     op_s32, 0x12345678L, 0x23456789L, +, baseline_q31, add_f,
+                     0.142f, 0.276f),
+    BENCH_CASE_FIXED(Q31_TEST_FLAG | ARITHMETIC_TEST_FLAG, mul_q31, "q31",
+                     op_s32, 0x12345678L, 0x23456789L, *, baseline_q31, mul_f,
+                     0.142f, 0.276f),
+    BENCH_CASE_FIXED(Q31_TEST_FLAG | ARITHMETIC_TEST_FLAG, mac_q31, "q31",
+                     op_s32, 0x12345678L, 0x23456789L, mac, baseline_q31,
+                     mul_f, 0.142f, 0.276f)};
+
+const num_bench_t *num_bench_get(u32 idx) {
+  if (idx < num_bench_count()) {
+    return benches + idx;
+  }
+  return 0;
+}
+
+u32 num_bench_count() { return sizeof(benches) / sizeof(num_bench_t); }
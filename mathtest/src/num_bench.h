@@ -0,0 +1,42 @@
+#ifndef NUM_BENCH_H
+#define NUM_BENCH_H
+
+#include "num_test.h"
+
+// Throughput loops for the num_test operations.
+//
+// Each loop applies one operation count times to an operand that changes
+// every iteration (so the compiler can't hoist it) and folds the results into
+// an accumulator that is returned (so it can't be removed). The baseline loop
+// does the same stepping and folding without the operation, subtracting its
+// time gives the cost of the operation itself.
+typedef operand_t (*num_bench_loop)(operand_t a, operand_t b, u32 count);
+
+typedef struct {
+  const char *name;
+  const char *type;
+  const char *op_str;
+  u32 o_execute_flags;
+  operand_t a;
+  operand_t b;
+  num_bench_loop loop;
+  num_bench_loop baseline;
+  // equivalent float operation the fixed-point entries are compared to
+  num_bench_loop float_loop;
+  num_bench_loop float_baseline;
+  operand_t float_a;
+  operand_t float_b;
+} num_bench_t;
+
+#if defined __cplusplus
+extern "C" {
+#endif
+
+const num_bench_t *num_bench_get(u32 idx);
+u32 num_bench_count();
+
+#if defined __cplusplus
+}
+#endif
+
+#endif // NUM_BENCH_H
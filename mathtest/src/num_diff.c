@@ -0,0 +1,395 @@
+#include <string.h>
+
+#include "num_diff.h"
+#include "num_reference.h"
+
+enum {
+  GENERATE_INTEGER,
+  GENERATE_SIGNED,
+  GENERATE_DIVISOR,
+  GENERATE_SIGNED_DIVISOR,
+  GENERATE_SHIFT,
+  GENERATE_SIGNED_SHIFT,
+  GENERATE_FLOAT,
+  GENERATE_DOUBLE,
+  GENERATE_FLOAT_TO_UNSIGNED,
+  GENERATE_FLOAT_TO_SIGNED,
+  GENERATE_DOUBLE_TO_UNSIGNED,
+  GENERATE_DOUBLE_TO_SIGNED,
+  GENERATE_DOUBLE_TO_S32,
+  GENERATE_DOUBLE_TO_FLOAT
+};
+
+// operand exponents stay inside these ranges so every result of + - * /
+// and the conversions is a normal number
+#define FLOAT_EXPONENT_RANGE 60
+#define DOUBLE_EXPONENT_RANGE 500
+
+#define DIFF_TARGET_BINARY(function_name, field, operation)                    \
+  static operand_t target_##function_name(operand_t a, operand_t b) {          \
+    operand_t result;                                                          \
+    memset(&result, 0, sizeof(result));                                        \
+    result.field = a.field operation b.field;                                  \
+    return result;                                                             \
+  }
+
+#define DIFF_TARGET_SHIFT(function_name, field, operation)                     \
+  static operand_t target_##function_name(operand_t a, operand_t b) {          \
+    operand_t result;                                                          \
+    memset(&result, 0, sizeof(result));                                        \
+    result.field = a.field operation b.op_int;                                 \
+    return result;                                                             \
+  }
+
+#define DIFF_TARGET_CAST(function_name, field, type, result_field)             \
+  static operand_t target_##function_name(operand_t a, operand_t b) {          \
+    operand_t result;                                                          \
+    (void)b;                                                                   \
+    memset(&result, 0, sizeof(result));                                        \
+    result.result_field = (type)a.field;                                       \
+    return result;                                                             \
+  }
+
+DIFF_TARGET_BINARY(mul_u64, op_u64, *)
+DIFF_TARGET_BINARY(div_u64, op_u64, /)
+DIFF_TARGET_BINARY(modulus_u64, op_u64, %)
+DIFF_TARGET_BINARY(div_s64, op_s64, /)
+DIFF_TARGET_BINARY(modulus_s64, op_s64, %)
+DIFF_TARGET_SHIFT(left_shift_u64, op_u64, <<)
+DIFF_TARGET_SHIFT(right_shift_u64, op_u64, >>)
+DIFF_TARGET_SHIFT(right_shift_s64, op_s64, >>)
+DIFF_TARGET_BINARY(add_f, op_f, +)
+DIFF_TARGET_BINARY(sub_f, op_f, -)
+DIFF_TARGET_BINARY(mul_f, op_f, *)
+DIFF_TARGET_BINARY(div_f, op_f, /)
+DIFF_TARGET_BINARY(add_d, op_d, +)
+DIFF_TARGET_BINARY(sub_d, op_d, -)
+DIFF_TARGET_BINARY(mul_d, op_d, *)
+DIFF_TARGET_BINARY(div_d, op_d, /)
+DIFF_TARGET_CAST(u64_to_f, op_u64, float, op_f)
+DIFF_TARGET_CAST(s64_to_f, op_s64, float, op_f)
+DIFF_TARGET_CAST(u64_to_d, op_u64, double, op_d)
+DIFF_TARGET_CAST(s64_to_d, op_s64, double, op_d)
+DIFF_TARGET_CAST(f_to_u64, op_f, u64, op_u64)
+DIFF_TARGET_CAST(f_to_s64, op_f, s64, op_s64)
+DIFF_TARGET_CAST(d_to_u64, op_d, u64, op_u64)
+DIFF_TARGET_CAST(d_to_s64, op_d, s64, op_s64)
+DIFF_TARGET_CAST(d_to_s32, op_d, s32, op_s32)
+DIFF_TARGET_CAST(f_to_d, op_f, double, op_d)
+DIFF_TARGET_CAST(d_to_f, op_d, float, op_f)
+
+// signed multiply wraps in the reference, the target multiplies unsigned
+// values so overflow is defined
+static operand_t target_mul_s64(operand_t a, operand_t b) {
+  operand_t result;
+  memset(&result, 0, sizeof(result));
+  result.op_s64 = (s64)(a.op_u64 * b.op_u64);
+  return result;
+}
+
+#define DIFF_CASE(o_execute_flags_value, function_name, operation_value,       \
+                  generator_value)                                             \
+  {                                                                            \
+    .name = #function_name, .op_str = #operation_value,                        \
+    .o_execute_flags = o_execute_flags_value, .generator = generator_value,    \
+    .target = target_##function_name,                                          \
+    .reference = num_reference_##function_name                                 \
+  }
+
+static const num_diff_t diffs[] = {
+    DIFF_CASE(U64_TEST_FLAG | ARITHMETIC_TEST_FLAG, mul_u64, *,
+              GENERATE_INTEGER),
+    DIFF_CASE(U64_TEST_FLAG | ARITHMETIC_TEST_FLAG, div_u64, /,
+              GENERATE_DIVISOR),
+    DIFF_CASE(U64_TEST_FLAG | ARITHMETIC_TEST_FLAG, modulus_u64, %,
+              GENERATE_DIVISOR),
+    DIFF_CASE(S64_TEST_FLAG | ARITHMETIC_TEST_FLAG, mul_s64, *,
+              GENERATE_SIGNED),
+    DIFF_CASE(S64_TEST_FLAG | ARITHMETIC_TEST_FLAG, div_s64, /,
+              GENERATE_SIGNED_DIVISOR),
+    DIFF_CASE(S64_TEST_FLAG | ARITHMETIC_TEST_FLAG, modulus_s64, %,
+              GENERATE_SIGNED_DIVISOR),
+    DIFF_CASE(U64_TEST_FLAG | SHIFT_TEST_FLAG, left_shift_u64, <<,
+              GENERATE_SHIFT),
+    DIFF_CASE(U64_TEST_FLAG | SHIFT_TEST_FLAG, right_shift_u64, >>,
+              GENERATE_SHIFT),
+    DIFF_CASE(S64_TEST_FLAG | SHIFT_TEST_FLAG, right_shift_s64, >>,
+              GENERATE_SIGNED_SHIFT),
+    DIFF_CASE(FLOAT_TEST_FLAG | ARITHMETIC_TEST_FLAG, add_f, +,
+              GENERATE_FLOAT),
+    DIFF_CASE(FLOAT_TEST_FLAG | ARITHMETIC_TEST_FLAG, sub_f, -,
+              GENERATE_FLOAT),
+    DIFF_CASE(FLOAT_TEST_FLAG | ARITHMETIC_TEST_FLAG, mul_f, *,
+              GENERATE_FLOAT),
+    DIFF_CASE(FLOAT_TEST_FLAG | ARITHMETIC_TEST_FLAG, div_f, /,
+              GENERATE_FLOAT),
+    DIFF_CASE(DOUBLE_TEST_FLAG | ARITHMETIC_TEST_FLAG, add_d, +,
+              GENERATE_DOUBLE),
+    DIFF_CASE(DOUBLE_TEST_FLAG | ARITHMETIC_TEST_FLAG, sub_d, -,
+              GENERATE_DOUBLE),
+    DIFF_CASE(DOUBLE_TEST_FLAG | ARITHMETIC_TEST_FLAG, mul_d, *,
+              GENERATE_DOUBLE),
+    DIFF_CASE(DOUBLE_TEST_FLAG | ARITHMETIC_TEST_FLAG, div_d, /,
+              GENERATE_DOUBLE),
+    DIFF_CASE(TYPE_CAST_TEST_FLAG | FLOAT_TEST_FLAG, u64_to_f, cast,
+              GENERATE_INTEGER),
+    DIFF_CASE(TYPE_CAST_TEST_FLAG | FLOAT_TEST_FLAG, s64_to_f, cast,
+              GENERATE_SIGNED),
+    DIFF_CASE(TYPE_CAST_TEST_FLAG | DOUBLE_TEST_FLAG, u64_to_d, cast,
+              GENERATE_INTEGER),
+    DIFF_CASE(TYPE_CAST_TEST_FLAG | DOUBLE_TEST_FLAG, s64_to_d, cast,
+              GENERATE_SIGNED),
+    DIFF_CASE(TYPE_CAST_TEST_FLAG | FLOAT_TEST_FLAG, f_to_u64, cast,
+              GENERATE_FLOAT_TO_UNSIGNED),
+    DIFF_CASE(TYPE_CAST_TEST_FLAG | FLOAT_TEST_FLAG, f_to_s64, cast,
+              GENERATE_FLOAT_TO_SIGNED),
+    DIFF_CASE(TYPE_CAST_TEST_FLAG | DOUBLE_TEST_FLAG, d_to_u64, cast,
+              GENERATE_DOUBLE_TO_UNSIGNED),
+    DIFF_CASE(TYPE_CAST_TEST_FLAG | DOUBLE_TEST_FLAG, d_to_s64, cast,
+              GENERATE_DOUBLE_TO_SIGNED),
+    DIFF_CASE(TYPE_CAST_TEST_FLAG | DOUBLE_TEST_FLAG, d_to_s32, cast,
+              GENERATE_DOUBLE_TO_S32),
+    DIFF_CASE(TYPE_CAST_TEST_FLAG | FLOAT_TEST_FLAG | DOUBLE_TEST_FLAG, f_to_d,
+              cast, GENERATE_FLOAT),
+    DIFF_CASE(TYPE_CAST_TEST_FLAG | FLOAT_TEST_FLAG | DOUBLE_TEST_FLAG, d_to_f,
+              cast, GENERATE_DOUBLE_TO_FLOAT)};
+
+const num_diff_t *num_diff_get(u32 idx) {
+  if (idx < num_diff_count()) {
+    return diffs + idx;
+  }
+  return 0;
+}
+
+u32 num_diff_count() { return sizeof(diffs) / sizeof(num_diff_t); }
+
+// splitmix64 so that every (seed, index) pair starts an independent stream
+static u64 next_random(u64 *state) {
+  u64 z = (*state += 0x9e3779b97f4a7c15ULL);
+  z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+  z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+  return z ^ (z >> 31);
+}
+
+// uniform in [0, limit)
+static u32 next_limit(u64 *state, u32 limit) {
+  return (u32)(((next_random(state) >> 32) * limit) >> 32);
+}
+
+// small and large magnitudes are equally likely
+static u64 next_integer(u64 *state) {
+  return next_random(state) >> next_limit(state, 64);
+}
+
+static u64 next_signed(u64 *state) {
+  const u64 value = next_integer(state);
+  return (next_random(state) & 1) ? 0 - value : value;
+}
+
+static u64 pack_float(u32 sign, int exponent, u64 mantissa) {
+  return ((u64)sign << 31) | ((u64)(exponent + 127) << 23) |
+         (mantissa & 0x7fffff);
+}
+
+static u64 pack_double(u32 sign, int exponent, u64 mantissa) {
+  return ((u64)sign << 63) | ((u64)(exponent + 1023) << 52) |
+         (mantissa & 0xfffffffffffffULL);
+}
+
+static int float_exponent(operand_t value) {
+  return (int)((value.op_u32 >> 23) & 0xff) - 127;
+}
+
+static int double_exponent(operand_t value) {
+  return (int)((value.op_u64 >> 52) & 0x7ff) - 1023;
+}
+
+static u32 float_sign(operand_t value) { return value.op_u32 >> 31; }
+static u32 double_sign(operand_t value) { return (u32)(value.op_u64 >> 63); }
+
+static int next_exponent(u64 *state, int minimum, int maximum) {
+  return minimum + (int)next_limit(state, (u32)(maximum - minimum + 1));
+}
+
+static void clear(operand_t *value) { memset(value, 0, sizeof(operand_t)); }
+
+void num_diff_generate(const num_diff_t *diff, u32 seed, u32 index,
+                       operand_t *a, operand_t *b) {
+  u64 state = ((u64)seed << 32) | index;
+  int exponent;
+  clear(a);
+  clear(b);
+  next_random(&state);
+
+  do {
+    switch (diff->generator) {
+    case GENERATE_INTEGER:
+    case GENERATE_DIVISOR:
+      a->op_u64 = next_integer(&state);
+      b->op_u64 = next_integer(&state);
+      break;
+    case GENERATE_SIGNED:
+    case GENERATE_SIGNED_DIVISOR:
+      a->op_u64 = next_signed(&state);
+      b->op_u64 = next_signed(&state);
+      break;
+    case GENERATE_SHIFT:
+      a->op_u64 = next_random(&state);
+      b->op_int = (int)next_limit(&state, 64);
+      break;
+    case GENERATE_SIGNED_SHIFT:
+      a->op_u64 = next_signed(&state);
+      b->op_int = (int)next_limit(&state, 64);
+      break;
+    case GENERATE_FLOAT:
+      // b is often close to a so that + and - cancel
+      exponent =
+          next_exponent(&state, -FLOAT_EXPONENT_RANGE, FLOAT_EXPONENT_RANGE);
+      a->op_u32 = (u32)pack_float((u32)next_random(&state) & 1, exponent,
+                                  next_random(&state));
+      if (next_random(&state) & 1) {
+        exponent += next_exponent(&state, -30, 30);
+      } else {
+        exponent =
+            next_exponent(&state, -FLOAT_EXPONENT_RANGE, FLOAT_EXPONENT_RANGE);
+      }
+      b->op_u32 = (u32)pack_float((u32)next_random(&state) & 1, exponent,
+                                  next_random(&state));
+      break;
+    case GENERATE_DOUBLE:
+      exponent = next_exponent(&state, -DOUBLE_EXPONENT_RANGE,
+                               DOUBLE_EXPONENT_RANGE);
+      a->op_u64 = pack_double((u32)next_random(&state) & 1, exponent,
+                              next_random(&state));
+      if (next_random(&state) & 1) {
+        exponent += next_exponent(&state, -60, 60);
+      } else {
+        exponent = next_exponent(&state, -DOUBLE_EXPONENT_RANGE,
+                                 DOUBLE_EXPONENT_RANGE);
+      }
+      b->op_u64 = pack_double((u32)next_random(&state) & 1, exponent,
+                              next_random(&state));
+      break;
+    case GENERATE_FLOAT_TO_UNSIGNED:
+      a->op_u32 = (u32)pack_float(0, next_exponent(&state, -4, 63),
+                                  next_random(&state));
+      break;
+    case GENERATE_FLOAT_TO_SIGNED:
+      a->op_u32 = (u32)pack_float((u32)next_random(&state) & 1,
+                                  next_exponent(&state, -4, 62),
+                                  next_random(&state));
+      break;
+    case GENERATE_DOUBLE_TO_UNSIGNED:
+      a->op_u64 = pack_double(0, next_exponent(&state, -4, 63),
+                              next_random(&state));
+      break;
+    case GENERATE_DOUBLE_TO_SIGNED:
+      a->op_u64 = pack_double((u32)next_random(&state) & 1,
+                              next_exponent(&state, -4, 62),
+                              next_random(&state));
+      break;
+    case GENERATE_DOUBLE_TO_S32:
+      a->op_u64 = pack_double((u32)next_random(&state) & 1,
+                              next_exponent(&state, -4, 30),
+                              next_random(&state));
+      break;
+    case GENERATE_DOUBLE_TO_FLOAT:
+      a->op_u64 = pack_double((u32)next_random(&state) & 1,
+                              next_exponent(&state, -120, 120),
+                              next_random(&state));
+      break;
+    default:
+      return;
+    }
+  } while (num_diff_is_valid(diff, *a, *b) == 0);
+}
+
+static int is_float_in_range(operand_t value, int minimum, int maximum) {
+  const int exponent = float_exponent(value);
+  return exponent >= minimum && exponent <= maximum;
+}
+
+static int is_double_in_range(operand_t value, int minimum, int maximum) {
+  const int exponent = double_exponent(value);
+  return exponent >= minimum && exponent <= maximum;
+}
+
+int num_diff_is_valid(const num_diff_t *diff, operand_t a, operand_t b) {
+  switch (diff->generator) {
+  case GENERATE_INTEGER:
+  case GENERATE_SIGNED:
+    return 1;
+  case GENERATE_DIVISOR:
+    return b.op_u64 != 0;
+  case GENERATE_SIGNED_DIVISOR:
+    // the quotient of INT64_MIN / -1 doesn't fit
+    return b.op_s64 != 0 &&
+           (b.op_s64 != -1 || a.op_u64 != 0x8000000000000000ULL);
+  case GENERATE_SHIFT:
+  case GENERATE_SIGNED_SHIFT:
+    return b.op_int >= 0 && b.op_int < 64;
+  case GENERATE_FLOAT:
+    return is_float_in_range(a, -FLOAT_EXPONENT_RANGE, FLOAT_EXPONENT_RANGE) &&
+           is_float_in_range(b, -FLOAT_EXPONENT_RANGE, FLOAT_EXPONENT_RANGE);
+  case GENERATE_DOUBLE:
+    return is_double_in_range(a, -DOUBLE_EXPONENT_RANGE,
+                              DOUBLE_EXPONENT_RANGE) &&
+           is_double_in_range(b, -DOUBLE_EXPONENT_RANGE,
+                              DOUBLE_EXPONENT_RANGE);
+  case GENERATE_FLOAT_TO_UNSIGNED:
+    return float_sign(a) == 0 && is_float_in_range(a, -4, 63);
+  case GENERATE_FLOAT_TO_SIGNED:
+    return is_float_in_range(a, -4, 62);
+  case GENERATE_DOUBLE_TO_UNSIGNED:
+    return double_sign(a) == 0 && is_double_in_range(a, -4, 63);
+  case GENERATE_DOUBLE_TO_SIGNED:
+    return is_double_in_range(a, -4, 62);
+  case GENERATE_DOUBLE_TO_S32:
+    return is_double_in_range(a, -4, 30);
+  case GENERATE_DOUBLE_TO_FLOAT:
+    return is_double_in_range(a, -120, 120);
+  }
+  return 0;
+}
+
+int num_diff_check(const num_diff_t *diff, operand_t a, operand_t b,
+                   operand_t *expected, operand_t *actual) {
+  *expected = diff->reference(a, b);
+  *actual = diff->target(a, b);
+  return memcmp(expected, actual, sizeof(operand_t)) == 0;
+}
+
+static int is_failure(const num_diff_t *diff, operand_t a, operand_t b) {
+  operand_t expected;
+  operand_t actual;
+  return num_diff_is_valid(diff, a, b) &&
+         num_diff_check(diff, a, b, &expected, &actual) == 0;
+}
+
+static int clear_bits(const num_diff_t *diff, operand_t *value,
+                      operand_t *a, operand_t *b) {
+  int is_changed = 0;
+  int bit;
+  for (bit = 63; bit >= 0; bit--) {
+    const u64 mask = 1ULL << bit;
+    if (value->op_u64 & mask) {
+      value->op_u64 &= ~mask;
+      if (is_failure(diff, *a, *b)) {
+        is_changed = 1;
+      } else {
+        value->op_u64 |= mask;
+      }
+    }
+  }
+  return is_changed;
+}
+
+void num_diff_minimize(const num_diff_t *diff, operand_t *a, operand_t *b) {
+  if (is_failure(diff, *a, *b) == 0) {
+    return;
+  }
+  // clearing a bit of b can allow clearing one of a, repeat until neither
+  // changes
+  while (clear_bits(diff, a, a, b) | clear_bits(diff, b, a, b)) {
+  }
+}
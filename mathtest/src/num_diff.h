@@ -0,0 +1,45 @@
+#ifndef NUM_DIFF_H
+#define NUM_DIFF_H
+
+#include "num_test.h"
+
+// Randomized differential testing of the target's arithmetic against
+// num_reference.c
+//
+// Each entry pairs the operation as the compiler implements it (inline code
+// or a runtime helper) with the software reference. Operand pairs are a pure
+// function of (seed, index) so any failure reproduces from those two numbers
+// regardless of how the work was split between threads.
+typedef operand_t (*num_diff_function)(operand_t a, operand_t b);
+
+typedef struct {
+  const char *name;
+  const char *op_str;
+  u32 o_execute_flags;
+  u32 generator;
+  num_diff_function target;
+  num_diff_function reference;
+} num_diff_t;
+
+#if defined __cplusplus
+extern "C" {
+#endif
+
+const num_diff_t *num_diff_get(u32 idx);
+u32 num_diff_count();
+
+void num_diff_generate(const num_diff_t *diff, u32 seed, u32 index,
+                       operand_t *a, operand_t *b);
+// whether a and b are inside the domain the generator draws from
+int num_diff_is_valid(const num_diff_t *diff, operand_t a, operand_t b);
+// evaluates both sides, returns 1 when the results are bit-identical
+int num_diff_check(const num_diff_t *diff, operand_t a, operand_t b,
+                   operand_t *expected, operand_t *actual);
+// clears operand bits, most significant first, while the pair still fails
+void num_diff_minimize(const num_diff_t *diff, operand_t *a, operand_t *b);
+
+#if defined __cplusplus
+}
+#endif
+
+#endif // NUM_DIFF_H
@@ -0,0 +1,140 @@
+#include "num_fixed.h"
+
+#define FIXED_BINARY(function_name, field)                                     \
+  static int test_##function_name(operand_t a, operand_t b, operand_t c,       \
+                                  operand_t result) {                          \
+    (void)c;                                                                   \
+    return function_name(a.field, b.field) == result.field;                    \
+  }
+
+#define FIXED_MAC(function_name, field)                                        \
+  static int test_##function_name(operand_t a, operand_t b, operand_t c,       \
+                                  operand_t result) {                          \
+    return function_name(c.field, a.field, b.field) == result.field;           \
+  }
+
+#define FIXED_CONVERT(function_name, field, result_field)                      \
+  static int test_##function_name(operand_t a, operand_t b, operand_t c,       \
+                                  operand_t result) {                          \
+    (void)b;                                                                   \
+    (void)c;                                                                   \
+    return function_name(a.field) == result.result_field;                      \
+  }
+
+FIXED_BINARY(q15_add, op_i16)
+FIXED_BINARY(q15_sub, op_i16)
+FIXED_BINARY(q15_mul, op_i16)
+FIXED_MAC(q15_mac, op_i16)
+FIXED_BINARY(q31_add, op_s32)
+FIXED_BINARY(q31_sub, op_s32)
+FIXED_BINARY(q31_mul, op_s32)
+FIXED_MAC(q31_mac, op_s32)
+FIXED_CONVERT(q15_from_f, op_f, op_i16)
+FIXED_CONVERT(q15_to_f, op_i16, op_f)
+FIXED_CONVERT(q31_from_f, op_f, op_s32)
+FIXED_CONVERT(q31_to_f, op_s32, op_f)
+FIXED_CONVERT(q15_to_q31, op_i16, op_s32)
+FIXED_CONVERT(q31_to_q15, op_s32, op_i16)
+
+#define FIXED_CASE(o_execute_flags_value, function_name, field, a_value,       \
+                   b_value, c_value, result_field, result_value)               \
+  {                                                                            \
+    .name = #function_name,                                                    \
+    .expression = #function_name "(" #a_value ", " #b_value ", " #c_value ")", \
+    .o_execute_flags = o_execute_flags_value,                                  \
+    .operation = test_##function_name, .a.field = a_value,                     \
+    .b.field = b_value, .c.field = c_value,                                    \
+    .result.result_field = result_value                                        \
+  }
+
+#define FIXED_Q15(function_name, a_value, b_value, result_value)               \
+  FIXED_CASE(Q15_TEST_FLAG | ARITHMETIC_TEST_FLAG, function_name, op_i16,      \
+             a_value, b_value, 0, op_i16, result_value)
+
+#define FIXED_Q15_MAC(a_value, b_value, c_value, result_value)                 \
+  FIXED_CASE(Q15_TEST_FLAG | ARITHMETIC_TEST_FLAG, q15_mac, op_i16, a_value,   \
+             b_value, c_value, op_i16, result_value)
+
+#define FIXED_Q31(function_name, a_value, b_value, result_value)               \
+  FIXED_CASE(Q31_TEST_FLAG | ARITHMETIC_TEST_FLAG, function_name, op_s32,      \
+             a_value, b_value, 0, op_s32, result_value)
+
+#define FIXED_Q31_MAC(a_value, b_value, c_value, result_value)                 \
+  FIXED_CASE(Q31_TEST_FLAG | ARITHMETIC_TEST_FLAG, q31_mac, op_s32, a_value,   \
+             b_value, c_value, op_s32, result_value)
+
+#define FIXED_CAST(o_execute_flags_value, function_name, field, a_value,       \
+                   result_field, result_value)                                 \
+  FIXED_CASE(TYPE_CAST_TEST_FLAG | o_execute_flags_value, function_name,       \
+             field, a_value, 0, 0, result_field, result_value)
+
+static const num_fixed_test_t tests[] = {
+    FIXED_Q15(q15_add, 0x4000, 0x2000, 0x6000),
+    FIXED_Q15(q15_add, 100, -200, -100),
+    FIXED_Q15(q15_add, 0x7000, 0x2000, Q15_MAX),
+    FIXED_Q15(q15_add, -0x7000, -0x2000, Q15_MIN),
+    FIXED_Q15(q15_sub, 0x4000, 0x2000, 0x2000),
+    FIXED_Q15(q15_sub, -0x7000, 0x2000, Q15_MIN),
+    FIXED_Q15(q15_sub, 0x7000, -0x2000, Q15_MAX),
+    FIXED_Q15(q15_mul, 0x4000, 0x4000, 0x2000),
+    FIXED_Q15(q15_mul, Q15_MIN, 0x4000, -0x4000),
+    FIXED_Q15(q15_mul, Q15_MAX, Q15_MAX, 0x7ffe),
+    FIXED_Q15(q15_mul, 181, 181, 1),
+    FIXED_Q15(q15_mul, 3, 5, 0),
+    FIXED_Q15(q15_mul, Q15_MIN, Q15_MIN, Q15_MAX),
+    FIXED_Q15_MAC(0x4000, 0x4000, 0x1000, 0x3000),
+    FIXED_Q15_MAC(0x4000, 0x4000, 0x7000, Q15_MAX),
+    FIXED_Q15_MAC(Q15_MIN, 0x4000, -0x7000, Q15_MIN),
+    FIXED_Q15_MAC(-0x4000, 0x4000, 0x1000, -0x1000),
+    FIXED_Q31(q31_add, 0x40000000L, 0x20000000L, 0x60000000L),
+    FIXED_Q31(q31_add, 0x70000000L, 0x20000000L, Q31_MAX),
+    FIXED_Q31(q31_add, -0x70000000L, -0x20000000L, Q31_MIN),
+    FIXED_Q31(q31_sub, -0x70000000L, 0x20000000L, Q31_MIN),
+    FIXED_Q31(q31_sub, 0x70000000L, -0x20000000L, Q31_MAX),
+    FIXED_Q31(q31_mul, 0x40000000L, 0x40000000L, 0x20000000L),
+    FIXED_Q31(q31_mul, Q31_MIN, 0x40000000L, -0x40000000L),
+    FIXED_Q31(q31_mul, Q31_MAX, Q31_MAX, 0x7ffffffeL),
+    FIXED_Q31(q31_mul, Q31_MIN, Q31_MIN, Q31_MAX),
+    FIXED_Q31(q31_mul, 46341, 46341, 1),
+    FIXED_Q31_MAC(0x40000000L, 0x40000000L, 0x10000000L, 0x30000000L),
+    FIXED_Q31_MAC(0x40000000L, 0x40000000L, 0x70000000L, Q31_MAX),
+    FIXED_Q31_MAC(Q31_MIN, 0x40000000L, -0x70000000L, Q31_MIN),
+    FIXED_CAST(Q15_TEST_FLAG, q15_from_f, op_f, 0.5f, op_i16, 0x4000),
+    FIXED_CAST(Q15_TEST_FLAG, q15_from_f, op_f, -0.25f, op_i16, -0x2000),
+    FIXED_CAST(Q15_TEST_FLAG, q15_from_f, op_f, 3.0f / 65536, op_i16, 2),
+    FIXED_CAST(Q15_TEST_FLAG, q15_from_f, op_f, -3.0f / 65536, op_i16, -2),
+    FIXED_CAST(Q15_TEST_FLAG, q15_from_f, op_f, 1.0f, op_i16, Q15_MAX),
+    FIXED_CAST(Q15_TEST_FLAG, q15_from_f, op_f, -2.0f, op_i16, Q15_MIN),
+    FIXED_CAST(Q15_TEST_FLAG, q15_to_f, op_i16, 0x4000, op_f, 0.5f),
+    FIXED_CAST(Q15_TEST_FLAG, q15_to_f, op_i16, Q15_MIN, op_f, -1.0f),
+    FIXED_CAST(Q31_TEST_FLAG, q31_from_f, op_f, 0.5f, op_s32, 0x40000000L),
+    FIXED_CAST(Q31_TEST_FLAG, q31_from_f, op_f, -0.75f, op_s32, -0x60000000L),
+    FIXED_CAST(Q31_TEST_FLAG, q31_from_f, op_f, 1.0f, op_s32, Q31_MAX),
+    FIXED_CAST(Q31_TEST_FLAG, q31_from_f, op_f, -1.0f, op_s32, Q31_MIN),
+    FIXED_CAST(Q31_TEST_FLAG, q31_to_f, op_s32, 0x40000000L, op_f, 0.5f),
+    FIXED_CAST(Q31_TEST_FLAG, q31_to_f, op_s32, Q31_MIN, op_f, -1.0f),
+    FIXED_CAST(Q15_TEST_FLAG | Q31_TEST_FLAG, q15_to_q31, op_i16, 0x4000,
+               op_s32, 0x40000000L),
+    FIXED_CAST(Q15_TEST_FLAG | Q31_TEST_FLAG, q15_to_q31, op_i16, Q15_MIN,
+               op_s32, Q31_MIN),
+    FIXED_CAST(Q15_TEST_FLAG | Q31_TEST_FLAG, q31_to_q15, op_s32,
+               0x12345678L, op_i16, 0x1234),
+    FIXED_CAST(Q15_TEST_FLAG | Q31_TEST_FLAG, q31_to_q15, op_s32,
+               0x1234c000L, op_i16, 0x1235),
+    FIXED_CAST(Q15_TEST_FLAG | Q31_TEST_FLAG, q31_to_q15, op_s32, Q31_MAX,
+               op_i16, Q15_MAX)};
+
+const num_fixed_test_t *num_fixed_test_get(u32 idx) {
+  if (idx < num_fixed_test_count()) {
+    return tests + idx;
+  }
+  return 0;
+}
+
+u32 num_fixed_test_count() {
+  return sizeof(tests) / sizeof(num_fixed_test_t);
+}
+
+int num_fixed_test_execute(const num_fixed_test_t *test) {
+  return test->operation(test->a, test->b, test->c, test->result);
+}
@@ -0,0 +1,130 @@
+#ifndef NUM_FIXED_H
+#define NUM_FIXED_H
+
+#include "num_test.h"
+
+enum {
+  // fixed-point groups, select alongside the operator flags
+  Q15_TEST_FLAG = (1 << 17),
+  Q31_TEST_FLAG = (1 << 18)
+};
+
+// Q15 and Q31 fractional arithmetic
+//
+// Values are fractions in [-1, 1) stored in s16/s32 (op_i16/op_s32 of
+// operand_t). Every operation saturates instead of wrapping and products
+// round to nearest (half up). The kernels are inline so benchmark and
+// application loops compile to the same code.
+typedef s16 q15_t;
+typedef s32 q31_t;
+
+#define Q15_MAX 0x7fff
+#define Q15_MIN (-0x7fff - 1)
+#define Q31_MAX 0x7fffffffL
+#define Q31_MIN (-0x7fffffffL - 1)
+
+static inline q15_t q15_saturate(s32 value) {
+  return value > Q15_MAX ? Q15_MAX : value < Q15_MIN ? Q15_MIN : (q15_t)value;
+}
+
+static inline q31_t q31_saturate(s64 value) {
+  return value > Q31_MAX ? Q31_MAX : value < Q31_MIN ? Q31_MIN : (q31_t)value;
+}
+
+static inline q15_t q15_add(q15_t a, q15_t b) {
+  return q15_saturate((s32)a + b);
+}
+
+static inline q15_t q15_sub(q15_t a, q15_t b) {
+  return q15_saturate((s32)a - b);
+}
+
+static inline q15_t q15_mul(q15_t a, q15_t b) {
+  return q15_saturate(((s32)a * b + 0x4000) >> 15);
+}
+
+static inline q15_t q15_mac(q15_t accumulator, q15_t a, q15_t b) {
+  return q15_saturate(accumulator + (((s32)a * b + 0x4000) >> 15));
+}
+
+static inline q31_t q31_add(q31_t a, q31_t b) {
+  return q31_saturate((s64)a + b);
+}
+
+static inline q31_t q31_sub(q31_t a, q31_t b) {
+  return q31_saturate((s64)a - b);
+}
+
+static inline q31_t q31_mul(q31_t a, q31_t b) {
+  return q31_saturate(((s64)a * b + 0x40000000) >> 31);
+}
+
+static inline q31_t q31_mac(q31_t accumulator, q31_t a, q31_t b) {
+  return q31_saturate(accumulator + (((s64)a * b + 0x40000000) >> 31));
+}
+
+// float conversions round half away from zero
+static inline q15_t q15_from_f(float value) {
+  const float scaled = value * 32768.0f;
+  if (scaled >= 32767.0f) {
+    return Q15_MAX;
+  }
+  if (scaled <= -32768.0f) {
+    return Q15_MIN;
+  }
+  return (q15_t)(scaled >= 0.0f ? scaled + 0.5f : scaled - 0.5f);
+}
+
+static inline float q15_to_f(q15_t value) { return value * (1.0f / 32768); }
+
+static inline q31_t q31_from_f(float value) {
+  const float scaled = value * 2147483648.0f;
+  if (scaled >= 2147483648.0f) {
+    return Q31_MAX;
+  }
+  if (scaled <= -2147483648.0f) {
+    return Q31_MIN;
+  }
+  return (q31_t)(scaled >= 0.0f ? scaled + 0.5f : scaled - 0.5f);
+}
+
+static inline float q31_to_f(q31_t value) {
+  return value * (1.0f / 2147483648.0f);
+}
+
+static inline q31_t q15_to_q31(q15_t value) { return (q31_t)value * 65536; }
+
+static inline q15_t q31_to_q15(q31_t value) {
+  return q15_saturate((s32)(((s64)value + 0x8000) >> 16));
+}
+
+// compares the result like the num_test operations
+typedef int (*num_fixed_operation)(operand_t a, operand_t b, operand_t c,
+                                   operand_t result);
+
+typedef struct {
+  const char *name;
+  const char *expression;
+  u32 o_execute_flags;
+  num_fixed_operation operation;
+  operand_t a;
+  operand_t b;
+  // accumulator of the mac operations
+  operand_t c;
+  operand_t result;
+} num_fixed_test_t;
+
+#if defined __cplusplus
+extern "C" {
+#endif
+
+const num_fixed_test_t *num_fixed_test_get(u32 idx);
+u32 num_fixed_test_count();
+// returns 1 when the operation gives the expected result
+int num_fixed_test_execute(const num_fixed_test_t *test);
+
+#if defined __cplusplus
+}
+#endif
+
+#endif // NUM_FIXED_H
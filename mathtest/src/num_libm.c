@@ -0,0 +1,179 @@
+#include <float.h>
+#include <math.h>
+
+#include "num_libm.h"
+
+#define FLOAT_MANTISSA_BITS 24
+#define DOUBLE_MANTISSA_BITS 53
+
+// long double functions are only a reference when they are wider
+#if LDBL_MANT_DIG > DBL_MANT_DIG
+#define REFERENCE_SIN sinl
+#define REFERENCE_COS cosl
+#define REFERENCE_EXP expl
+#define REFERENCE_LOG logl
+#define REFERENCE_SQRT sqrtl
+#define REFERENCE_POW powl
+#else
+#define REFERENCE_SIN sin
+#define REFERENCE_COS cos
+#define REFERENCE_EXP exp
+#define REFERENCE_LOG log
+#define REFERENCE_SQRT sqrt
+#define REFERENCE_POW pow
+#endif
+
+#define NUM_LIBM_UNARY(function_name, type, reference_type, reference_name)    \
+  static double function_##function_name(double x, double y) {                 \
+    (void)y;                                                                   \
+    return function_name((type)x);                                             \
+  }                                                                            \
+  static long double reference_##function_name(long double x,                 \
+                                                long double y) {               \
+    (void)y;                                                                   \
+    return reference_name((reference_type)x);                                  \
+  }                                                                            \
+  static double loop_##function_name(double x, double step, double y,          \
+                                     u32 count) {                              \
+    type sum = 0;                                                              \
+    type value = (type)x;                                                      \
+    const type delta = (type)step;                                             \
+    u32 i;                                                                     \
+    (void)y;                                                                   \
+    for (i = 0; i < count; i++) {                                              \
+      sum += function_name(value);                                             \
+      value += delta;                                                          \
+    }                                                                          \
+    return sum;                                                                \
+  }
+
+#define NUM_LIBM_BINARY(function_name, type, reference_type, reference_name)   \
+  static double function_##function_name(double x, double y) {                 \
+    return function_name((type)x, (type)y);                                    \
+  }                                                                            \
+  static long double reference_##function_name(long double x,                 \
+                                                long double y) {               \
+    return reference_name((reference_type)x, (reference_type)y);               \
+  }                                                                            \
+  static double loop_##function_name(double x, double step, double y,          \
+                                     u32 count) {                              \
+    type sum = 0;                                                              \
+    type value = (type)x;                                                      \
+    const type delta = (type)step;                                             \
+    const type exponent = (type)y;                                             \
+    u32 i;                                                                     \
+    for (i = 0; i < count; i++) {                                              \
+      sum += function_name(value, exponent);                                   \
+      value += delta;                                                          \
+    }                                                                          \
+    return sum;                                                                \
+  }
+
+NUM_LIBM_UNARY(sinf, float, double, sin)
+NUM_LIBM_UNARY(cosf, float, double, cos)
+NUM_LIBM_UNARY(expf, float, double, exp)
+NUM_LIBM_UNARY(logf, float, double, log)
+NUM_LIBM_UNARY(sqrtf, float, double, sqrt)
+NUM_LIBM_BINARY(powf, float, double, pow)
+NUM_LIBM_UNARY(sin, double, long double, REFERENCE_SIN)
+NUM_LIBM_UNARY(cos, double, long double, REFERENCE_COS)
+NUM_LIBM_UNARY(exp, double, long double, REFERENCE_EXP)
+NUM_LIBM_UNARY(log, double, long double, REFERENCE_LOG)
+NUM_LIBM_UNARY(sqrt, double, long double, REFERENCE_SQRT)
+NUM_LIBM_BINARY(pow, double, long double, REFERENCE_POW)
+
+#define LIBM_CASE(o_execute_flags_value, function_name, type_name,             \
+                  is_logarithmic_value, x_minimum_value, x_maximum_value,      \
+                  y_minimum_value, y_maximum_value, ulp_budget_value)          \
+  {                                                                            \
+    .name = #function_name, .type = type_name,                                 \
+    .o_execute_flags = o_execute_flags_value | LIBM_TEST_FLAG,                 \
+    .is_logarithmic = is_logarithmic_value, .x_minimum = x_minimum_value,      \
+    .x_maximum = x_maximum_value, .y_minimum = y_minimum_value,                \
+    .y_maximum = y_maximum_value, .ulp_budget = ulp_budget_value,              \
+    .function = function_##function_name,                                      \
+    .reference = reference_##function_name, .loop = loop_##function_name       \
+  }
+
+// a correctly rounded result is off by at most 0.5 ulp (plus the rounding of
+// the reference), sqrt must be correctly rounded, the others are allowed the
+// few ulp good libraries stay within
+static const num_libm_t libms[] = {
+    LIBM_CASE(FLOAT_TEST_FLAG, sinf, "float", 0, -10 * M_PI, 10 * M_PI, 0, 0,
+              2.0),
+    LIBM_CASE(FLOAT_TEST_FLAG, cosf, "float", 0, -10 * M_PI, 10 * M_PI, 0, 0,
+              2.0),
+    LIBM_CASE(FLOAT_TEST_FLAG, expf, "float", 0, -87.0, 88.0, 0, 0, 2.0),
+    LIBM_CASE(FLOAT_TEST_FLAG, logf, "float", 1, 0x1p-100, 0x1p100, 0, 0, 2.0),
+    LIBM_CASE(FLOAT_TEST_FLAG, sqrtf, "float", 1, 0x1p-100, 0x1p100, 0, 0,
+              0.501),
+    LIBM_CASE(FLOAT_TEST_FLAG, powf, "float", 1, 0x1p-10, 0x1p10, -8.0, 8.0,
+              4.0),
+    LIBM_CASE(DOUBLE_TEST_FLAG, sin, "double", 0, -10 * M_PI, 10 * M_PI, 0, 0,
+              2.0),
+    LIBM_CASE(DOUBLE_TEST_FLAG, cos, "double", 0, -10 * M_PI, 10 * M_PI, 0, 0,
+              2.0),
+    LIBM_CASE(DOUBLE_TEST_FLAG, exp, "double", 0, -700.0, 709.0, 0, 0, 2.0),
+    LIBM_CASE(DOUBLE_TEST_FLAG, log, "double", 1, 0x1p-1000, 0x1p1000, 0, 0,
+              2.0),
+    LIBM_CASE(DOUBLE_TEST_FLAG, sqrt, "double", 1, 0x1p-1000, 0x1p1000, 0, 0,
+              0.501),
+    LIBM_CASE(DOUBLE_TEST_FLAG, pow, "double", 1, 0x1p-50, 0x1p50, -16.0, 16.0,
+              4.0)};
+
+const num_libm_t *num_libm_get(u32 idx) {
+  if (idx < num_libm_count()) {
+    return libms + idx;
+  }
+  return 0;
+}
+
+u32 num_libm_count() { return sizeof(libms) / sizeof(num_libm_t); }
+
+static int is_float(const num_libm_t *libm) { return libm->type[0] == 'f'; }
+
+static double to_type(const num_libm_t *libm, double value) {
+  return is_float(libm) ? (double)(float)value : value;
+}
+
+void num_libm_input(const num_libm_t *libm, u32 idx, u32 count, double *x,
+                    double *y) {
+  const double position = count > 1 ? (double)idx / (count - 1) : 0.0;
+  // the golden ratio sequence covers y evenly for any prefix of the sweep
+  const double y_position = fmod(idx * 0.6180339887498949, 1.0);
+
+  if (libm->is_logarithmic) {
+    const double low = log2(libm->x_minimum);
+    const double high = log2(libm->x_maximum);
+    *x = exp2(low + (high - low) * position);
+  } else {
+    *x = libm->x_minimum + (libm->x_maximum - libm->x_minimum) * position;
+  }
+  *y = libm->y_minimum + (libm->y_maximum - libm->y_minimum) * y_position;
+  *x = to_type(libm, *x);
+  *y = to_type(libm, *y);
+}
+
+int num_libm_reference_bits(const num_libm_t *libm) {
+  return is_float(libm) ? DBL_MANT_DIG : LDBL_MANT_DIG;
+}
+
+double num_libm_ulp_error(const num_libm_t *libm, double x, double y) {
+  const int bits = is_float(libm) ? FLOAT_MANTISSA_BITS : DOUBLE_MANTISSA_BITS;
+  const double result = libm->function(to_type(libm, x), to_type(libm, y));
+  const long double reference =
+      libm->reference(to_type(libm, x), to_type(libm, y));
+  int exponent;
+
+  if (num_libm_reference_bits(libm) <= bits) {
+    return 0.0;
+  }
+  if (reference == 0.0L) {
+    return result == 0.0 ? 0.0 : HUGE_VAL;
+  }
+
+  // one ulp of the result type at the reference value
+  frexpl(reference, &exponent);
+  return (double)(fabsl((long double)result - reference) /
+                  ldexpl(1.0L, exponent - bits));
+}
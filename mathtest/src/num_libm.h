@@ -0,0 +1,61 @@
+#ifndef NUM_LIBM_H
+#define NUM_LIBM_H
+
+#include "num_test.h"
+
+enum {
+  // selects the libm suite, combine with FLOAT_TEST_FLAG/DOUBLE_TEST_FLAG
+  LIBM_TEST_FLAG = (1 << 16)
+};
+
+// Accuracy and speed of the libm functions
+//
+// Each entry sweeps its input domain, inputs are rounded to the entry's type
+// before the call. The error is measured against the next wider type (double
+// for float functions, long double for double functions) in units in the last
+// place of the result type. Where long double is no wider than double (ARM)
+// the double functions have no reference and only their speed is measured.
+typedef double (*num_libm_loop)(double x, double step, double y, u32 count);
+typedef double (*num_libm_function)(double x, double y);
+typedef long double (*num_libm_reference)(long double x, long double y);
+
+typedef struct {
+  const char *name;
+  const char *type;
+  u32 o_execute_flags;
+  // x is log spaced over the domain, which must then be above zero
+  int is_logarithmic;
+  double x_minimum;
+  double x_maximum;
+  // second argument of pow, otherwise unused
+  double y_minimum;
+  double y_maximum;
+  // largest acceptable error in ulp
+  double ulp_budget;
+  // the function in its own type, widened to double
+  num_libm_function function;
+  num_libm_reference reference;
+  // sums count results stepping x by step, for the timing
+  num_libm_loop loop;
+} num_libm_t;
+
+#if defined __cplusplus
+extern "C" {
+#endif
+
+const num_libm_t *num_libm_get(u32 idx);
+u32 num_libm_count();
+
+// input idx of count for the dense sweep
+void num_libm_input(const num_libm_t *libm, u32 idx, u32 count, double *x,
+                    double *y);
+// error of the result for (x, y) in ulp, zero when there is no reference
+double num_libm_ulp_error(const num_libm_t *libm, double x, double y);
+// mantissa bits of the reference, no more than the type's means no reference
+int num_libm_reference_bits(const num_libm_t *libm);
+
+#if defined __cplusplus
+}
+#endif
+
+#endif // NUM_LIBM_H
@@ -0,0 +1,432 @@
+#include <string.h>
+
+#include "num_reference.h"
+
+typedef struct {
+  int precision; // significand bits including the implicit one
+  int bias;
+  int sign_shift;
+} format_t;
+
+static const format_t float_format = {24, 127, 31};
+static const format_t double_format = {53, 1023, 63};
+
+// a number is sign * significand * 2^exponent, exponent is that of the
+// significand's least significant bit
+typedef struct {
+  u32 sign;
+  int exponent;
+  u64 significand;
+} unpacked_t;
+
+static operand_t make_u64(u64 value) {
+  operand_t result;
+  memset(&result, 0, sizeof(result));
+  result.op_u64 = value;
+  return result;
+}
+
+static operand_t make_u32(u32 value) {
+  operand_t result;
+  memset(&result, 0, sizeof(result));
+  result.op_u32 = value;
+  return result;
+}
+
+static int most_significant_bit(u64 value) {
+  int result = -1;
+  while (value) {
+    value >>= 1;
+    result++;
+  }
+  return result;
+}
+
+static u64 low_mask(int bits) {
+  return bits >= 64 ? ~0ULL : (1ULL << bits) - 1;
+}
+
+// shifts right keeping any lost bits as a one in the least significant bit
+static u64 shift_right_jam(u64 value, int count) {
+  if (count <= 0) {
+    return value;
+  }
+  if (count >= 64) {
+    return value != 0;
+  }
+  return (value >> count) | ((value & low_mask(count)) != 0);
+}
+
+// rounds to nearest even, a sticky bit must already be jammed into bit 0
+// with at least one bit between it and the rounding position
+static u64 round_pack(const format_t *format, unpacked_t value) {
+  const int msb = most_significant_bit(value.significand);
+  const int extra = msb - (format->precision - 1);
+  u64 significand = value.significand;
+  int exponent = value.exponent + msb;
+
+  if (significand == 0) {
+    return (u64)value.sign << format->sign_shift;
+  }
+
+  if (extra <= 0) {
+    significand <<= -extra;
+  } else {
+    const u64 remainder = significand & low_mask(extra);
+    const u64 half = 1ULL << (extra - 1);
+    significand >>= extra;
+    if (remainder > half || (remainder == half && (significand & 1))) {
+      significand++;
+      if (significand >> format->precision) {
+        significand >>= 1;
+        exponent++;
+      }
+    }
+  }
+
+  return ((u64)value.sign << format->sign_shift) |
+         ((u64)(exponent + format->bias) << (format->precision - 1)) |
+         (significand & low_mask(format->precision - 1));
+}
+
+static unpacked_t unpack(const format_t *format, u64 bits) {
+  const int exponent_field =
+      (int)((bits >> (format->precision - 1)) &
+            low_mask(format->sign_shift - format->precision + 1));
+  unpacked_t result;
+  result.sign = (u32)(bits >> format->sign_shift) & 1;
+  result.exponent = exponent_field - format->bias - (format->precision - 1);
+  result.significand = (bits & low_mask(format->precision - 1)) |
+                       (1ULL << (format->precision - 1));
+  return result;
+}
+
+static u64 double_bits(operand_t value) { return value.op_u64; }
+static u64 float_bits(operand_t value) { return value.op_u32; }
+
+static u64 mul_u64(u64 a, u64 b) {
+  const u32 a_low = (u32)a;
+  const u32 a_high = (u32)(a >> 32);
+  const u32 b_low = (u32)b;
+  const u32 b_high = (u32)(b >> 32);
+  const u32 cross = a_low * b_high + a_high * b_low;
+  return (u64)a_low * b_low + ((u64)cross << 32);
+}
+
+// full 128-bit product from 32-bit partial products
+static void mul_u64_wide(u64 a, u64 b, u64 *high, u64 *low) {
+  const u64 a_low = (u32)a;
+  const u64 a_high = a >> 32;
+  const u64 b_low = (u32)b;
+  const u64 b_high = b >> 32;
+  const u64 low_low = a_low * b_low;
+  const u64 low_high = a_low * b_high;
+  const u64 high_low = a_high * b_low;
+  const u64 middle = (low_low >> 32) + (u32)low_high + (u32)high_low;
+  *low = (middle << 32) | (u32)low_low;
+  *high = a_high * b_high + (low_high >> 32) + (high_low >> 32) +
+          (middle >> 32);
+}
+
+// restoring division one bit at a time
+static u64 divide_u64(u64 numerator, u64 denominator, u64 *remainder) {
+  u64 quotient = 0;
+  u64 partial = 0;
+  int i;
+  for (i = 63; i >= 0; i--) {
+    const u64 carry = partial >> 63;
+    partial = (partial << 1) | ((numerator >> i) & 1);
+    quotient <<= 1;
+    if (carry || partial >= denominator) {
+      partial -= denominator;
+      quotient |= 1;
+    }
+  }
+  *remainder = partial;
+  return quotient;
+}
+
+static u64 magnitude(s64 value) {
+  return value < 0 ? 0 - (u64)value : (u64)value;
+}
+
+static u64 negate_if(u64 value, int is_negative) {
+  return is_negative ? 0 - value : value;
+}
+
+operand_t num_reference_mul_u64(operand_t a, operand_t b) {
+  return make_u64(mul_u64(a.op_u64, b.op_u64));
+}
+
+operand_t num_reference_div_u64(operand_t a, operand_t b) {
+  u64 remainder;
+  return make_u64(divide_u64(a.op_u64, b.op_u64, &remainder));
+}
+
+operand_t num_reference_modulus_u64(operand_t a, operand_t b) {
+  u64 remainder;
+  divide_u64(a.op_u64, b.op_u64, &remainder);
+  return make_u64(remainder);
+}
+
+operand_t num_reference_mul_s64(operand_t a, operand_t b) {
+  return make_u64(mul_u64(a.op_u64, b.op_u64));
+}
+
+// C division truncates, the remainder takes the sign of the dividend
+operand_t num_reference_div_s64(operand_t a, operand_t b) {
+  u64 remainder;
+  const u64 quotient =
+      divide_u64(magnitude(a.op_s64), magnitude(b.op_s64), &remainder);
+  return make_u64(negate_if(quotient, (a.op_s64 < 0) != (b.op_s64 < 0)));
+}
+
+operand_t num_reference_modulus_s64(operand_t a, operand_t b) {
+  u64 remainder;
+  divide_u64(magnitude(a.op_s64), magnitude(b.op_s64), &remainder);
+  return make_u64(negate_if(remainder, a.op_s64 < 0));
+}
+
+// the shifts only use 32-bit shifts of the two halves
+static u64 shift_right(u64 value, int count, u32 fill) {
+  const u32 high = (u32)(value >> 32);
+  const u32 low = (u32)value;
+  u32 result_high;
+  u32 result_low;
+  if (count == 0) {
+    return value;
+  }
+  if (count < 32) {
+    result_low = (low >> count) | (high << (32 - count));
+    result_high = (high >> count) | (fill << (32 - count));
+  } else if (count == 32) {
+    result_low = high;
+    result_high = fill;
+  } else {
+    result_low = (high >> (count - 32)) | (fill << (64 - count));
+    result_high = fill;
+  }
+  return ((u64)result_high << 32) | result_low;
+}
+
+operand_t num_reference_left_shift_u64(operand_t a, operand_t b) {
+  const u32 high = (u32)(a.op_u64 >> 32);
+  const u32 low = (u32)a.op_u64;
+  const int count = b.op_int;
+  if (count == 0) {
+    return make_u64(a.op_u64);
+  }
+  if (count < 32) {
+    return make_u64(((u64)((high << count) | (low >> (32 - count))) << 32) |
+                    (u32)(low << count));
+  }
+  return make_u64((u64)(u32)(low << (count - 32)) << 32);
+}
+
+operand_t num_reference_right_shift_u64(operand_t a, operand_t b) {
+  return make_u64(shift_right(a.op_u64, b.op_int, 0));
+}
+
+operand_t num_reference_right_shift_s64(operand_t a, operand_t b) {
+  const u32 fill = a.op_s64 < 0 ? 0xffffffffUL : 0;
+  return make_u64(shift_right(a.op_u64, b.op_int, fill));
+}
+
+static u64 add_double(u64 a_bits, u64 b_bits) {
+  unpacked_t a = unpack(&double_format, a_bits);
+  unpacked_t b = unpack(&double_format, b_bits);
+  unpacked_t result;
+
+  // ten guard bits below the significands
+  a.significand <<= 10;
+  a.exponent -= 10;
+  b.significand <<= 10;
+  b.exponent -= 10;
+
+  if (b.exponent > a.exponent ||
+      (b.exponent == a.exponent && b.significand > a.significand)) {
+    const unpacked_t swap = a;
+    a = b;
+    b = swap;
+  }
+  b.significand = shift_right_jam(b.significand, a.exponent - b.exponent);
+
+  result.sign = a.sign;
+  result.exponent = a.exponent;
+  if (a.sign == b.sign) {
+    result.significand = a.significand + b.significand;
+  } else {
+    result.significand = a.significand - b.significand;
+    if (result.significand == 0) {
+      // x - x is +0 when rounding to nearest
+      result.sign = 0;
+    }
+  }
+  return round_pack(&double_format, result);
+}
+
+static u64 mul_double(u64 a_bits, u64 b_bits) {
+  const unpacked_t a = unpack(&double_format, a_bits);
+  const unpacked_t b = unpack(&double_format, b_bits);
+  unpacked_t result;
+  u64 high;
+  u64 low;
+
+  // the 106-bit product is cut to 64 bits with the rest as a sticky bit
+  mul_u64_wide(a.significand, b.significand, &high, &low);
+  result.sign = a.sign ^ b.sign;
+  result.exponent = a.exponent + b.exponent + 42;
+  result.significand =
+      (high << 22) | (low >> 42) | ((low & low_mask(42)) != 0);
+  return round_pack(&double_format, result);
+}
+
+static u64 div_double(u64 a_bits, u64 b_bits) {
+  const unpacked_t a = unpack(&double_format, a_bits);
+  const unpacked_t b = unpack(&double_format, b_bits);
+  unpacked_t result;
+  u64 remainder = a.significand;
+  u64 quotient = 0;
+  int i;
+
+  // 63 quotient bits of a.significand * 2^62 / b.significand
+  for (i = 0; i < 63; i++) {
+    quotient <<= 1;
+    if (remainder >= b.significand) {
+      remainder -= b.significand;
+      quotient |= 1;
+    }
+    remainder <<= 1;
+  }
+
+  result.sign = a.sign ^ b.sign;
+  result.exponent = a.exponent - b.exponent - 62;
+  result.significand = quotient | (remainder != 0);
+  return round_pack(&double_format, result);
+}
+
+static u64 widen(u64 float_value) {
+  return round_pack(&double_format, unpack(&float_format, float_value));
+}
+
+static u64 narrow(u64 double_value) {
+  return round_pack(&float_format, unpack(&double_format, double_value));
+}
+
+operand_t num_reference_add_d(operand_t a, operand_t b) {
+  return make_u64(add_double(double_bits(a), double_bits(b)));
+}
+
+operand_t num_reference_sub_d(operand_t a, operand_t b) {
+  return make_u64(add_double(double_bits(a), double_bits(b) ^ (1ULL << 63)));
+}
+
+operand_t num_reference_mul_d(operand_t a, operand_t b) {
+  return make_u64(mul_double(double_bits(a), double_bits(b)));
+}
+
+operand_t num_reference_div_d(operand_t a, operand_t b) {
+  return make_u64(div_double(double_bits(a), double_bits(b)));
+}
+
+operand_t num_reference_add_f(operand_t a, operand_t b) {
+  return make_u32(
+      (u32)narrow(add_double(widen(float_bits(a)), widen(float_bits(b)))));
+}
+
+operand_t num_reference_sub_f(operand_t a, operand_t b) {
+  return make_u32((u32)narrow(add_double(
+      widen(float_bits(a)), widen(float_bits(b)) ^ (1ULL << 63))));
+}
+
+operand_t num_reference_mul_f(operand_t a, operand_t b) {
+  return make_u32(
+      (u32)narrow(mul_double(widen(float_bits(a)), widen(float_bits(b)))));
+}
+
+operand_t num_reference_div_f(operand_t a, operand_t b) {
+  return make_u32(
+      (u32)narrow(div_double(widen(float_bits(a)), widen(float_bits(b)))));
+}
+
+static u64 from_integer(const format_t *format, u64 value, int is_negative) {
+  unpacked_t result;
+  result.sign = (u32)is_negative;
+  result.exponent = 0;
+  result.significand = value;
+  if (value == 0) {
+    return 0;
+  }
+  return round_pack(format, result);
+}
+
+operand_t num_reference_u64_to_f(operand_t a, operand_t b) {
+  (void)b;
+  return make_u32((u32)from_integer(&float_format, a.op_u64, 0));
+}
+
+operand_t num_reference_s64_to_f(operand_t a, operand_t b) {
+  (void)b;
+  return make_u32(
+      (u32)from_integer(&float_format, magnitude(a.op_s64), a.op_s64 < 0));
+}
+
+operand_t num_reference_u64_to_d(operand_t a, operand_t b) {
+  (void)b;
+  return make_u64(from_integer(&double_format, a.op_u64, 0));
+}
+
+operand_t num_reference_s64_to_d(operand_t a, operand_t b) {
+  (void)b;
+  return make_u64(
+      from_integer(&double_format, magnitude(a.op_s64), a.op_s64 < 0));
+}
+
+// conversion to integer truncates toward zero
+static u64 to_integer(const format_t *format, u64 bits) {
+  const unpacked_t value = unpack(format, bits);
+  u64 result;
+  if (value.exponent >= 0) {
+    result = value.significand << value.exponent;
+  } else if (value.exponent <= -64) {
+    result = 0;
+  } else {
+    result = value.significand >> -value.exponent;
+  }
+  return negate_if(result, value.sign);
+}
+
+operand_t num_reference_f_to_u64(operand_t a, operand_t b) {
+  (void)b;
+  return make_u64(to_integer(&float_format, float_bits(a)));
+}
+
+operand_t num_reference_f_to_s64(operand_t a, operand_t b) {
+  (void)b;
+  return make_u64(to_integer(&float_format, float_bits(a)));
+}
+
+operand_t num_reference_d_to_u64(operand_t a, operand_t b) {
+  (void)b;
+  return make_u64(to_integer(&double_format, double_bits(a)));
+}
+
+operand_t num_reference_d_to_s64(operand_t a, operand_t b) {
+  (void)b;
+  return make_u64(to_integer(&double_format, double_bits(a)));
+}
+
+operand_t num_reference_d_to_s32(operand_t a, operand_t b) {
+  (void)b;
+  return make_u32((u32)to_integer(&double_format, double_bits(a)));
+}
+
+operand_t num_reference_f_to_d(operand_t a, operand_t b) {
+  (void)b;
+  return make_u64(widen(float_bits(a)));
+}
+
+operand_t num_reference_d_to_f(operand_t a, operand_t b) {
+  (void)b;
+  return make_u32((u32)narrow(double_bits(a)));
+}
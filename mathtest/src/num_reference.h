@@ -0,0 +1,56 @@
+#ifndef NUM_REFERENCE_H
+#define NUM_REFERENCE_H
+
+#include "num_test.h"
+
+// Software reference for the operations the toolchain implements with
+// runtime helpers (64-bit multiply/divide/shift, conversions and soft-float).
+//
+// Integers are computed from 32-bit halves with shift-and-subtract division.
+// Floating point is computed on the IEEE 754 bit patterns with round to
+// nearest even, so no result depends on the FPU or libgcc. Floating point
+// operands and results must be normal numbers, float arithmetic is the
+// double result rounded to float which is exact for + - * /. Results clear
+// the operand before setting the field, like the target functions.
+#if defined __cplusplus
+extern "C" {
+#endif
+
+operand_t num_reference_mul_u64(operand_t a, operand_t b);
+operand_t num_reference_div_u64(operand_t a, operand_t b);
+operand_t num_reference_modulus_u64(operand_t a, operand_t b);
+operand_t num_reference_mul_s64(operand_t a, operand_t b);
+operand_t num_reference_div_s64(operand_t a, operand_t b);
+operand_t num_reference_modulus_s64(operand_t a, operand_t b);
+// b.op_int is the shift count from 0 to 63
+operand_t num_reference_left_shift_u64(operand_t a, operand_t b);
+operand_t num_reference_right_shift_u64(operand_t a, operand_t b);
+operand_t num_reference_right_shift_s64(operand_t a, operand_t b);
+
+operand_t num_reference_add_d(operand_t a, operand_t b);
+operand_t num_reference_sub_d(operand_t a, operand_t b);
+operand_t num_reference_mul_d(operand_t a, operand_t b);
+operand_t num_reference_div_d(operand_t a, operand_t b);
+operand_t num_reference_add_f(operand_t a, operand_t b);
+operand_t num_reference_sub_f(operand_t a, operand_t b);
+operand_t num_reference_mul_f(operand_t a, operand_t b);
+operand_t num_reference_div_f(operand_t a, operand_t b);
+
+// conversions ignore b
+operand_t num_reference_u64_to_f(operand_t a, operand_t b);
+operand_t num_reference_s64_to_f(operand_t a, operand_t b);
+operand_t num_reference_u64_to_d(operand_t a, operand_t b);
+operand_t num_reference_s64_to_d(operand_t a, operand_t b);
+operand_t num_reference_f_to_u64(operand_t a, operand_t b);
+operand_t num_reference_f_to_s64(operand_t a, operand_t b);
+operand_t num_reference_d_to_u64(operand_t a, operand_t b);
+operand_t num_reference_d_to_s64(operand_t a, operand_t b);
+operand_t num_reference_d_to_s32(operand_t a, operand_t b);
+operand_t num_reference_f_to_d(operand_t a, operand_t b);
+operand_t num_reference_d_to_f(operand_t a, operand_t b);
+
+#if defined __cplusplus
+}
+#endif
+
+#endif // NUM_REFERENCE_H
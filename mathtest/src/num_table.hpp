@@ -0,0 +1,286 @@
+#ifndef NUM_TABLE_HPP
+#define NUM_TABLE_HPP
+
+#include <limits>
+
+#include "num_test.h"
+
+// Compile-time generated num_test cases
+//
+// A case holds its operator and operands only. The expected result is
+// evaluated by the compiler while the constexpr tables in num_test.cpp are
+// built, so the tables are read-only data (flash) and no result is entered by
+// hand. Folding doubles as verification: signed overflow, integer division by
+// zero or a shift past the operand width is not a constant expression and
+// fails the build.
+//
+// The compiler is only authoritative for finite results. It refuses to fold
+// infinities and NaN, so those follow the IEEE 754 defaults spelled out in
+// evaluate(). Float-to-integer conversions saturate, NaN converts to zero,
+// which is what the VCVT instruction and the ARM EABI helpers do. C++ leaves
+// those conversions undefined, so other targets leave the cases out (see
+// is_supported()).
+namespace num_table {
+
+#if defined __arm__
+constexpr bool is_conversion_saturating = true;
+#else
+constexpr bool is_conversion_saturating = false;
+#endif
+
+enum class Operator : u8 {
+  add,
+  subtract,
+  multiply,
+  divide,
+  modulus,
+  shift_left,
+  shift_right,
+  equal,
+  greater,
+  greater_equal,
+  less,
+  less_equal
+};
+
+// operand types, distinct even where the C types are not (s32 and int)
+struct U64 {
+  using type = u64;
+  static constexpr type operand_t::*member = &operand_t::op_u64;
+  static constexpr u32 flag = U64_TEST_FLAG;
+  static constexpr const char *name = "u64";
+};
+
+struct S64 {
+  using type = s64;
+  static constexpr type operand_t::*member = &operand_t::op_s64;
+  static constexpr u32 flag = S64_TEST_FLAG;
+  static constexpr const char *name = "s64";
+};
+
+struct U32 {
+  using type = u32;
+  static constexpr type operand_t::*member = &operand_t::op_u32;
+  static constexpr u32 flag = U32_TEST_FLAG;
+  static constexpr const char *name = "u32";
+};
+
+struct S32 {
+  using type = s32;
+  static constexpr type operand_t::*member = &operand_t::op_s32;
+  static constexpr u32 flag = S32_TEST_FLAG;
+  static constexpr const char *name = "s32";
+};
+
+struct Int {
+  using type = int;
+  static constexpr type operand_t::*member = &operand_t::op_int;
+  static constexpr u32 flag = INT_TEST_FLAG;
+  static constexpr const char *name = "int";
+};
+
+struct Float {
+  using type = float;
+  static constexpr type operand_t::*member = &operand_t::op_f;
+  static constexpr u32 flag = FLOAT_TEST_FLAG;
+  static constexpr const char *name = "f";
+};
+
+struct Double {
+  using type = double;
+  static constexpr type operand_t::*member = &operand_t::op_d;
+  static constexpr u32 flag = DOUBLE_TEST_FLAG;
+  static constexpr const char *name = "d";
+};
+
+constexpr bool is_comparison(Operator op) { return op >= Operator::equal; }
+
+constexpr u32 operator_flag(Operator op) {
+  return is_comparison(op)           ? COMPARISON_TEST_FLAG
+         : op >= Operator::shift_left ? SHIFT_TEST_FLAG
+                                      : ARITHMETIC_TEST_FLAG;
+}
+
+// not constexpr, a case that reaches it fails the build
+inline int invalid_operator() { return 0; }
+
+// the operation as the target executes it, also used for folding
+template <typename T> constexpr T apply(Operator op, T a, T b) {
+  switch (op) {
+  case Operator::add:
+    return a + b;
+  case Operator::subtract:
+    return a - b;
+  case Operator::multiply:
+    return a * b;
+  case Operator::divide:
+    return a / b;
+  case Operator::modulus:
+    if constexpr (std::numeric_limits<T>::is_integer) {
+      return a % b;
+    }
+    break;
+  case Operator::shift_left:
+    if constexpr (std::numeric_limits<T>::is_integer) {
+      return a << b;
+    }
+    break;
+  case Operator::shift_right:
+    if constexpr (std::numeric_limits<T>::is_integer) {
+      return a >> b;
+    }
+    break;
+  case Operator::equal:
+    return a == b;
+  case Operator::greater:
+    return a > b;
+  case Operator::greater_equal:
+    return a >= b;
+  case Operator::less:
+    return a < b;
+  case Operator::less_equal:
+    return a <= b;
+  }
+  // modulus and shifts of floating point operands
+  return T(invalid_operator());
+}
+
+template <typename T> constexpr bool is_nan(T value) { return value != value; }
+
+template <typename T> constexpr bool is_infinite(T value) {
+  return value == std::numeric_limits<T>::infinity()
+         || value == -std::numeric_limits<T>::infinity();
+}
+
+template <typename T> constexpr bool is_negative(T value) {
+  return __builtin_signbit(value);
+}
+
+template <typename T> constexpr T infinity(bool is_negative) {
+  return is_negative ? -std::numeric_limits<T>::infinity()
+                     : std::numeric_limits<T>::infinity();
+}
+
+// the folded result of a op b, comparisons give 0 or 1
+template <typename T> constexpr T evaluate(Operator op, T a, T b) {
+  if constexpr (!std::numeric_limits<T>::is_integer) {
+    constexpr T nan = std::numeric_limits<T>::quiet_NaN();
+    if (is_comparison(op)) {
+      // comparisons with NaN or infinity fold normally
+      return apply(op, a, b);
+    }
+    if (is_nan(a) || is_nan(b)) {
+      return nan;
+    }
+    const bool is_sign_different = is_negative(a) != is_negative(b);
+    switch (op) {
+    case Operator::add:
+    case Operator::subtract:
+      if (is_infinite(a) || is_infinite(b)) {
+        const T b_signed = op == Operator::subtract ? -b : b;
+        if (is_infinite(a) && is_infinite(b_signed)) {
+          return is_negative(a) == is_negative(b_signed) ? a : nan;
+        }
+        return is_infinite(a) ? a : b_signed;
+      }
+      break;
+    case Operator::multiply:
+      if (is_infinite(a) || is_infinite(b)) {
+        return a == 0 || b == 0 ? nan : infinity<T>(is_sign_different);
+      }
+      break;
+    case Operator::divide:
+      if (is_infinite(a)) {
+        return is_infinite(b) ? nan : infinity<T>(is_sign_different);
+      }
+      if (is_infinite(b)) {
+        return is_sign_different ? -T(0) : T(0);
+      }
+      if (b == 0) {
+        return a == 0 ? nan : infinity<T>(is_sign_different);
+      }
+      break;
+    default:
+      break;
+    }
+    if constexpr (sizeof(T) < sizeof(double)) {
+      // double has more than twice the precision so rounding the double
+      // result is exact, and it cannot overflow where float does
+      return static_cast<T>(apply<double>(op, a, b));
+    }
+  }
+  return apply(op, a, b);
+}
+
+template <typename To, typename From> constexpr To convert(From value) {
+  if constexpr (
+    !std::numeric_limits<From>::is_integer
+    && std::numeric_limits<To>::is_integer) {
+    if (is_nan(value)) {
+      return 0;
+    }
+    // a value at or past the converted limit truncates to the limit or is
+    // out of range, either way the result is the limit
+    if (value >= From(std::numeric_limits<To>::max())) {
+      return std::numeric_limits<To>::max();
+    }
+    if (value <= From(std::numeric_limits<To>::min())) {
+      return std::numeric_limits<To>::min();
+    }
+  }
+  return static_cast<To>(value);
+}
+
+// true if value truncated toward zero fits To (the conversion is defined)
+template <typename To, typename From> constexpr bool is_in_range(From value) {
+  if (is_nan(value)) {
+    return false;
+  }
+  // the limits of the integer types are exact in float and double or round
+  // up to the next power of two, which is the first value out of range
+  using limits = std::numeric_limits<To>;
+  const bool is_above_minimum =
+    limits::is_signed ? value >= From(limits::min()) : value > From(-1);
+  return is_above_minimum && value < From(limits::max()) + From(1);
+}
+
+template <typename T> struct Case {
+  using type = typename T::type;
+
+  constexpr Case(Operator op, type a, type b)
+    : op(op), a(a), b(b), result(evaluate(op, a, b)) {}
+
+  Operator op;
+  type a;
+  type b;
+  type result;
+};
+
+template <typename From, typename To> struct Conversion {
+  constexpr Conversion(typename From::type a)
+    : a(a), result(convert<typename To::type>(a)) {}
+
+  typename From::type a;
+  typename To::type result;
+};
+
+template <typename T> constexpr bool is_supported(const Case<T> &) {
+  return true;
+}
+
+// the saturating float-to-integer cases are only checked where the target
+// defines the result
+template <typename From, typename To>
+constexpr bool is_supported(const Conversion<From, To> &entry) {
+  if constexpr (
+    !std::numeric_limits<typename From::type>::is_integer
+    && std::numeric_limits<typename To::type>::is_integer) {
+    return is_conversion_saturating
+           || is_in_range<typename To::type>(entry.a);
+  }
+  return true;
+}
+
+} // namespace num_table
+
+#endif // NUM_TABLE_HPP
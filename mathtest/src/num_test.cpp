@@ -0,0 +1,1320 @@
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <iterator>
+#include <type_traits>
+
+#include "num_table.hpp"
+#include "num_test.h"
+
+using namespace num_table;
+
+namespace {
+
+// the expected results are folded by the compiler, see num_table.hpp
+constexpr Case<U64> u64_cases[] = {
+  {Operator::multiply, 100ULL, 100ULL},
+  {Operator::multiply, 999ULL, 888ULL},
+  {Operator::multiply, 9999ULL, 888ULL},
+  {Operator::multiply, 99999ULL, 888ULL},
+  {Operator::multiply, 999999ULL, 888ULL},
+  {Operator::multiply, 9999999ULL, 888ULL},
+  {Operator::multiply, 99999999ULL, 888ULL},
+  {Operator::multiply, 99999999ULL, -888ULL},
+  {Operator::multiply, 999999999ULL, 888ULL},
+  {Operator::multiply, 999999999ULL, 999999ULL},
+  {Operator::multiply, 999999999ULL, 9999999ULL},
+  {Operator::multiply, 999983ULL, 999983ULL},
+  {Operator::multiply, 67ULL, 67ULL},
+  {Operator::multiply, 9223372036854775807ULL, 1ULL},
+  {Operator::multiply, 9223372036854775807ULL, 2ULL},
+  {Operator::multiply, 9223372036854775807ULL, 3ULL},
+  {Operator::multiply, 4611686018427387903ULL, 4ULL},
+  {Operator::multiply, 2305843009213693951ULL, 8ULL},
+  {Operator::multiply, 2305843009213693951ULL, 0ULL},
+  {Operator::multiply, 0x0fffffffffffffffULL, 2ULL},
+  {Operator::multiply, 0x0000ffff1fffffffULL, 12ULL},
+  {Operator::multiply, 0x00fffffffffffffeULL, 3ULL},
+  {Operator::multiply, 0x00000fffffffffffULL, 8ULL},
+  {Operator::multiply, 0x00000fffffffffffULL, 0x00000000ffULL},
+  {Operator::divide, 100ULL, 100ULL},
+  {Operator::divide, 17ULL, 1ULL},
+  {Operator::divide, 1ULL, 10ULL},
+  {Operator::divide, 41ULL, 1ULL},
+  {Operator::divide, 1000000000ULL, 10ULL},
+  {Operator::divide, 37ULL, 1000000000ULL},
+  {Operator::divide, 1000000000ULL, 4000000000ULL},
+  {Operator::divide, 998681ULL, 999983ULL},
+  {Operator::divide, 998681ULL, 17ULL},
+  {Operator::divide, 999491999491ULL, 11ULL},
+  {Operator::divide, 11ULL, 999491999491ULL},
+  {Operator::divide, 11ULL, 18446744073709551614ULL},
+  {Operator::divide, 18446744073709551614ULL, 1ULL},
+  {Operator::divide, 18446744073709551614ULL, 2ULL},
+  {Operator::divide, 18446744073709551614ULL, 4ULL},
+  {Operator::divide, 18446744073709551614ULL, 8ULL},
+  {Operator::divide, 18446744073709551614ULL, 11ULL},
+  {Operator::divide, 18446744073709551614ULL, 16ULL},
+  {Operator::divide, 18446744073709551614ULL, 9223372036854775807ULL},
+  {Operator::divide, 18446744073709551614ULL, 4611686018427387903ULL},
+  {Operator::divide, 18446744073709551614ULL, 2305843009213693951ULL},
+  {Operator::divide, 998831ULL, 1ULL},
+  {Operator::divide, 0xfffffeffffffffffULL, 2ULL},
+  {Operator::divide, 0xfffffefffffffffeULL, 2ULL},
+  {Operator::divide, 0xffffffffffffffffULL, 0xffffffffffffffffULL},
+  {Operator::divide, 0xfffffffffffffffeULL, 0xfffffffffffffffeULL},
+  {Operator::divide, 0x8000000000000000ULL, 0x8000000000000000ULL},
+  {Operator::shift_left, 0x0000000000000001ULL, 17ULL},
+  {Operator::shift_left, 0x0000000000000001ULL, 33ULL},
+  {Operator::shift_left, 0x1000000000000001ULL, 33ULL},
+  {Operator::shift_left, 0xffffffffffffffffULL, 12ULL},
+  {Operator::shift_left, 0xeeeeeeeeeeeeeeeeULL, 28ULL},
+  {Operator::shift_left, 0x8888888888888888ULL, 31ULL},
+  {Operator::shift_left, 0x0000000080000000ULL, 31ULL},
+  {Operator::shift_right, 0x0000000000000001ULL, 17ULL},
+  {Operator::shift_right, 0x0000000000000001ULL, 33ULL},
+  {Operator::shift_right, 0x1000000000000001ULL, 33ULL},
+  {Operator::shift_right, 0xffffffffffffffffULL, 12ULL},
+  {Operator::shift_right, 0xeeeeeeeeeeeeeeeeULL, 28ULL},
+  {Operator::shift_right, 0x8888888888888888ULL, 31ULL},
+  {Operator::shift_right, 0x0000000080000000ULL, 31ULL},
+  {Operator::equal, 100ULL, 100ULL},
+  {Operator::equal, 18446744073709551614ULL, 18446744073709551615ULL},
+  {Operator::equal, 18446744073709551614ULL, 0ULL},
+  {Operator::equal, 1ULL, 18446744073709551615ULL},
+  {Operator::equal, 999491999491ULL, 18446744073709551615ULL},
+  {Operator::equal, 0ULL, 0ULL},
+  {Operator::equal, 1ULL, 1ULL},
+  {Operator::equal, 1ULL, 0ULL},
+  {Operator::equal, 18446744073709551615ULL, 18446744073709551615ULL},
+  {Operator::equal, 18446744073709551615ULL, 0ULL},
+  {Operator::equal, 18446744073709551615ULL, 9223372036854775807ULL},
+  {Operator::equal, 9223372036854775807ULL, 18446744073709551615ULL},
+  {Operator::equal, 9223372036854775807ULL, 0ULL},
+  {Operator::equal, 1ULL, 9223372036854775807ULL},
+  {Operator::equal, 4611686018427387903ULL, 9223372036854775807ULL},
+  {Operator::equal, 0xffffffffffffffffULL, 0xffffffffffffffffULL},
+  {Operator::equal, 0xfffffffffffffffeULL, 0xfffffffffffffffeULL},
+  {Operator::equal, 0x8000000000000000ULL, 0x8000000000000000ULL},
+  {Operator::subtract, 100ULL, 100ULL},
+  {Operator::subtract, 18446744073709551614ULL, 18446744073709551615ULL},
+  {Operator::subtract, 18446744073709551615ULL, 18446744073709551614ULL},
+  {Operator::subtract, 18446744073709551615ULL, 9223372036854775807ULL},
+  {Operator::subtract, 18446744073709551614ULL, 0ULL},
+  {Operator::subtract, 0ULL, 0ULL},
+  {Operator::subtract, 1ULL, 0ULL},
+  {Operator::subtract, 1ULL, 1ULL},
+  {Operator::subtract, 0ULL, 18446744073709551614ULL},
+  {Operator::subtract, 18446744073709551614ULL, 0ULL},
+  {Operator::subtract, 18446744073709551614ULL, 18446744073709551614ULL},
+  {Operator::subtract, 999377ULL, 999023ULL},
+  {Operator::subtract, 999359ULL, 999983ULL},
+  {Operator::add, 100ULL, 100ULL},
+  {Operator::add, 0ULL, 0ULL},
+  {Operator::add, 0ULL, 1ULL},
+  {Operator::add, 1ULL, 1ULL},
+  {Operator::add, 1ULL, 12ULL},
+  {Operator::add, 9223372036854775807ULL, 9223372036854775807ULL},
+  {Operator::add, 18446744073709551614ULL, 0ULL},
+  {Operator::add, 18446744073709551614ULL, 1ULL},
+  {Operator::add, 18446744073709551614ULL, 9223372036854775807ULL},
+  {Operator::add, 0ULL, 9223372036854775807ULL},
+  {Operator::add, 1ULL, 9223372036854775807ULL},
+  {Operator::add, 2305843009213693951ULL, 9223372036854775807ULL},
+  {Operator::modulus, 100ULL, 100ULL},
+  {Operator::modulus, 1ULL, 1ULL},
+  {Operator::modulus, 100ULL, 1ULL},
+  {Operator::modulus, 10ULL, 100ULL},
+  {Operator::modulus, 17ULL, 1ULL},
+  {Operator::modulus, 1ULL, 10ULL},
+  {Operator::modulus, 41ULL, 1ULL},
+  {Operator::modulus, 1000000000ULL, 10ULL},
+  {Operator::modulus, 37ULL, 1000000000ULL},
+  {Operator::modulus, 1000000000ULL, 4000000000ULL},
+  {Operator::modulus, 998681ULL, 999983ULL},
+  {Operator::modulus, 998681ULL, 17ULL},
+  {Operator::modulus, 999491999491ULL, 11ULL},
+  {Operator::modulus, 11ULL, 999491999491ULL},
+  {Operator::modulus, 11ULL, 18446744073709551614ULL},
+  {Operator::modulus, 18446744073709551614ULL, 1ULL},
+  {Operator::modulus, 18446744073709551614ULL, 2ULL},
+  {Operator::modulus, 18446744073709551614ULL, 4ULL},
+  {Operator::modulus, 18446744073709551614ULL, 8ULL},
+  {Operator::modulus, 18446744073709551614ULL, 11ULL},
+  {Operator::modulus, 18446744073709551614ULL, 16ULL},
+  {Operator::modulus, 998831ULL, 1ULL},
+  {Operator::modulus, 18446744073709551614ULL, 9223372036854775807ULL},
+  {Operator::modulus, 18446744073709551614ULL, 4611686018427387903ULL},
+  {Operator::modulus, 18446744073709551614ULL, 2305843009213693951ULL},
+  {Operator::greater, 100ULL, 100ULL},
+  {Operator::greater, 100ULL, 1ULL},
+  {Operator::greater, 0ULL, 100ULL},
+  {Operator::greater, 1ULL, 0ULL},
+  {Operator::greater, 18446744073709551614ULL, 2305843009213693951ULL},
+  {Operator::greater, 2305843009213693951ULL, 18446744073709551614ULL},
+  {Operator::greater, 18446744073709551614ULL, 18446744073709551614ULL},
+  {Operator::greater, 2305843009213693951ULL, 2305843009213693951ULL},
+  {Operator::greater, 18446744073709551614ULL, 0ULL},
+  {Operator::greater, 18446744073709551614ULL, 1ULL},
+  {Operator::greater, 1ULL, 18446744073709551614ULL},
+  {Operator::greater, 0ULL, 18446744073709551614ULL},
+  {Operator::greater_equal, 100ULL, 100ULL},
+  {Operator::greater_equal, 100ULL, 1ULL},
+  {Operator::greater_equal, 0ULL, 100ULL},
+  {Operator::greater_equal, 1ULL, 0ULL},
+  {Operator::greater_equal, 18446744073709551614ULL, 2305843009213693951ULL},
+  {Operator::greater_equal, 2305843009213693951ULL, 18446744073709551614ULL},
+  {Operator::greater_equal, 18446744073709551614ULL, 18446744073709551614ULL},
+  {Operator::greater_equal, 2305843009213693951ULL, 2305843009213693951ULL},
+  {Operator::greater_equal, 18446744073709551614ULL, 0ULL},
+  {Operator::greater_equal, 18446744073709551614ULL, 1ULL},
+  {Operator::greater_equal, 1ULL, 18446744073709551614ULL},
+  {Operator::greater_equal, 0ULL, 18446744073709551614ULL},
+  {Operator::less, 100ULL, 100ULL},
+  {Operator::less, 100ULL, 1ULL},
+  {Operator::less, 0ULL, 100ULL},
+  {Operator::less, 1ULL, 0ULL},
+  {Operator::less, 18446744073709551614ULL, 2305843009213693951ULL},
+  {Operator::less, 2305843009213693951ULL, 18446744073709551614ULL},
+  {Operator::less, 18446744073709551614ULL, 18446744073709551614ULL},
+  {Operator::less, 2305843009213693951ULL, 2305843009213693951ULL},
+  {Operator::less, 18446744073709551614ULL, 0ULL},
+  {Operator::less, 18446744073709551614ULL, 1ULL},
+  {Operator::less, 1ULL, 18446744073709551614ULL},
+  {Operator::less, 0ULL, 18446744073709551614ULL},
+  {Operator::less_equal, 100ULL, 100ULL},
+  {Operator::less_equal, 100ULL, 1ULL},
+  {Operator::less_equal, 0ULL, 100ULL},
+  {Operator::less_equal, 1ULL, 0ULL},
+  {Operator::less_equal, 18446744073709551614ULL, 2305843009213693951ULL},
+  {Operator::less_equal, 2305843009213693951ULL, 18446744073709551614ULL},
+  {Operator::less_equal, 18446744073709551614ULL, 18446744073709551614ULL},
+  {Operator::less_equal, 2305843009213693951ULL, 2305843009213693951ULL},
+  {Operator::less_equal, 18446744073709551614ULL, 0ULL},
+  {Operator::less_equal, 18446744073709551614ULL, 1ULL},
+  {Operator::less_equal, 1ULL, 18446744073709551614ULL},
+  {Operator::less_equal, 0ULL, 18446744073709551614ULL}
+};
+
+constexpr Case<S64> s64_cases[] = {
+  {Operator::multiply, 100LL, 100LL},
+  {Operator::multiply, 999LL, 888LL},
+  {Operator::multiply, 9999LL, 888LL},
+  {Operator::multiply, 9999999LL, 888LL},
+  {Operator::multiply, 99999999LL, 888LL},
+  {Operator::multiply, 99999999LL, -888LL},
+  {Operator::multiply, 999999999LL, 999999LL},
+  {Operator::multiply, 999999999LL, 9999999LL},
+  {Operator::multiply, -999999999LL, 9999999LL},
+  {Operator::multiply, 999983LL, 999983LL},
+  {Operator::multiply, 67LL, 67LL},
+  {Operator::multiply, -67LL, -67LL},
+  {Operator::multiply, 9223372036854775807LL, 1LL},
+  {Operator::multiply, 3223372036854775806LL, 2LL},
+  {Operator::multiply, 4611686018427387903LL, 2LL},
+  {Operator::multiply, 2305843009213693951LL, 4LL},
+  {Operator::multiply, 2305843009213693951LL, 0LL},
+  {Operator::multiply, -9223372036854775807LL, 1LL},
+  {Operator::multiply, -3223372036854775807LL, 2LL},
+  {Operator::multiply, -4611686018427387903LL, 2LL},
+  {Operator::multiply, -2305843009213693951LL, 4LL},
+  {Operator::multiply, -2305843009213693951LL, 0LL},
+  {Operator::multiply, -9223372036854775807LL, -1LL},
+  {Operator::multiply, -3223372036854775807LL, -2LL},
+  {Operator::multiply, -4611686018427387903LL, -2LL},
+  {Operator::multiply, -2305843009213693951LL, -4LL},
+  {Operator::multiply, -2305843009213693951LL, -0LL},
+  {Operator::divide, 100LL, 100LL},
+  {Operator::divide, 17LL, 1LL},
+  {Operator::divide, 1LL, 10LL},
+  {Operator::divide, 41LL, 1LL},
+  {Operator::divide, 1000000000LL, 10LL},
+  {Operator::divide, 37LL, 1000000000LL},
+  {Operator::divide, 1000000000LL, 4000000000LL},
+  {Operator::divide, 998681LL, 999983LL},
+  {Operator::divide, 998681LL, 17LL},
+  {Operator::divide, 999491999491LL, 11LL},
+  {Operator::divide, 11LL, 999491999491LL},
+  {Operator::divide, 11LL, 8446744073709551614LL},
+  {Operator::divide, 7446744073709551614LL, 1LL},
+  {Operator::divide, 9223372036854775807LL, 2LL},
+  {Operator::divide, 9223372036854775807LL, 4LL},
+  {Operator::divide, 9223372036854775807LL, 8LL},
+  {Operator::divide, 9223372036854775807LL, 11LL},
+  {Operator::divide, 9223372036854775807LL, 16LL},
+  {Operator::divide, 9223372036854775807LL, 9223372036854775807LL},
+  {Operator::divide, 9223372036854775807LL, 4611686018427387903LL},
+  {Operator::divide, 9223372036854775807LL, 2305843009213693951LL},
+  {Operator::divide, 998831LL, 1LL},
+  {Operator::divide, 998831LL, -999809LL},
+  {Operator::divide, -998917LL, -999809LL},
+  {Operator::divide, -17LL, 1LL},
+  {Operator::divide, 1LL, 10LL},
+  {Operator::divide, -41LL, -1LL},
+  {Operator::divide, -1000000000LL, 10LL},
+  {Operator::divide, -37LL, 1000000000LL},
+  {Operator::divide, -1000000000LL, 4000000000LL},
+  {Operator::divide, -998681LL, 999983LL},
+  {Operator::divide, -998681LL, 17LL},
+  {Operator::divide, 999491999491LL, -11LL},
+  {Operator::divide, -11LL, -999491999491LL},
+  {Operator::divide, 0LL, 999491999491LL},
+  {Operator::divide, 0LL, -999491999491LL},
+  {Operator::divide, -11LL, 8446744073709551614LL},
+  {Operator::divide, -8446744073709551614LL, 1LL},
+  {Operator::divide, -9223372036854775807LL, 2LL},
+  {Operator::divide, 9223372036854775807LL, -4LL},
+  {Operator::divide, -9223372036854775807LL, 8LL},
+  {Operator::divide, 9223372036854775807LL, -11LL},
+  {Operator::divide, -9223372036854775807LL, 16LL},
+  {Operator::divide, 9223372036854775807LL, -9223372036854775807LL},
+  {Operator::divide, -9223372036854775807LL, 4611686018427387903LL},
+  {Operator::divide, 9223372036854775807LL, -2305843009213693951LL},
+  {Operator::divide, 0LL, -2305843009213693951LL},
+  {Operator::equal, 100LL, 100LL},
+  {Operator::equal, 9223372036854775807LL, 9223372036854775807LL},
+  {Operator::equal, 9223372036854775807LL, 0LL},
+  {Operator::equal, 1LL, 9223372036854775807LL},
+  {Operator::equal, 999491999491LL, 9223372036854775807LL},
+  {Operator::equal, 0LL, 0LL},
+  {Operator::equal, 1LL, 1LL},
+  {Operator::equal, 1LL, 0LL},
+  {Operator::equal, 9223372036854775807LL, 9223372036854775807LL},
+  {Operator::equal, 9223372036854775807LL, 0LL},
+  {Operator::equal, 9223372036854775807LL, 4611686018427387903LL},
+  {Operator::equal, 4611686018427387903LL, 4611686018427387903LL},
+  {Operator::equal, 4611686018427387903LL, 0LL},
+  {Operator::equal, 1LL, 4611686018427387903LL},
+  {Operator::equal, 2305843009213693951LL, 4611686018427387903LL},
+  {Operator::equal, 2305843009213693951LL, 2305843009213693951LL},
+  {Operator::equal, -9223372036854775807LL, 9223372036854775807LL},
+  {Operator::equal, -9223372036854775807LL, -9223372036854775807LL},
+  {Operator::equal, 9223372036854775807LL, -9223372036854775807LL},
+  {Operator::equal, -9223372036854775807LL, 0LL},
+  {Operator::equal, -1LL, 9223372036854775807LL},
+  {Operator::equal, 999491999491LL, -9223372036854775807LL},
+  {Operator::equal, 1LL, -1LL},
+  {Operator::equal, -1LL, 0LL},
+  {Operator::equal, 9223372036854775807LL, -9223372036854775807LL},
+  {Operator::equal, -9223372036854775807LL, 0LL},
+  {Operator::equal, -9223372036854775807LL, 4611686018427387903LL},
+  {Operator::equal, 4611686018427387903LL, -4611686018427387903LL},
+  {Operator::equal, -4611686018427387903LL, 0LL},
+  {Operator::equal, 1LL, -4611686018427387903LL},
+  {Operator::equal, -2305843009213693951LL, 4611686018427387903LL},
+  {Operator::equal, 2305843009213693951LL, -2305843009213693951LL},
+  {Operator::subtract, 100LL, 100LL},
+  {Operator::subtract, 0LL, 0LL},
+  {Operator::subtract, 1LL, 0LL},
+  {Operator::subtract, 1LL, 1LL},
+  {Operator::subtract, 9223372036854775807LL, 9223372036854775807LL},
+  {Operator::subtract, 9223372036854775807LL, 2305843009213693951LL},
+  {Operator::subtract, 9223372036854775807LL, 4611686018427387903LL},
+  {Operator::subtract, 9223372036854775807LL, 0LL},
+  {Operator::subtract, 0LL, 9223372036854775807LL},
+  {Operator::subtract, 9223372036854775807LL, 0LL},
+  {Operator::subtract, 9223372036854775807LL, 9223372036854775807LL},
+  {Operator::subtract, 999377LL, 999023LL},
+  {Operator::subtract, 999359LL, 999983LL},
+  {Operator::subtract, -1LL, 0LL},
+  {Operator::subtract, -1LL, 1LL},
+  {Operator::subtract, 4223372036854775807LL, -4223372036854775807LL},
+  {Operator::subtract, -4223372036854775807LL, 2305843009213693951LL},
+  {Operator::subtract, 4223372036854775807LL, -4611686018427387903LL},
+  {Operator::subtract, -9223372036854775807LL, 0LL},
+  {Operator::subtract, 0LL, -9223372036854775807LL},
+  {Operator::subtract, -9223372036854775807LL, 0LL},
+  {Operator::subtract, 4611686018427387903LL, 9223372036854775807LL},
+  {Operator::subtract, 999377LL, -999023LL},
+  {Operator::subtract, -999359LL, 999983LL},
+  {Operator::add, 100LL, 100LL},
+  {Operator::add, 0LL, 0LL},
+  {Operator::add, 1LL, 0LL},
+  {Operator::add, 1LL, 1LL},
+  {Operator::add, 4223372036854775807LL, 4223372036854775807LL},
+  {Operator::add, 6223372036854775807LL, 2305843009213693951LL},
+  {Operator::add, 4223372036854775807LL, 4611686018427387903LL},
+  {Operator::add, 9223372036854775807LL, 0LL},
+  {Operator::add, 0LL, 9223372036854775807LL},
+  {Operator::add, 9223372036854775807LL, 0LL},
+  {Operator::add, 1223372036854775807LL, 7223372036854775807LL},
+  {Operator::add, 999377LL, 999023LL},
+  {Operator::add, 999359LL, 999983LL},
+  {Operator::add, -1LL, 0LL},
+  {Operator::add, -1LL, 1LL},
+  {Operator::add, 9223372036854775807LL, -9223372036854775807LL},
+  {Operator::add, -9223372036854775807LL, 2305843009213693951LL},
+  {Operator::add, 9223372036854775807LL, -4611686018427387903LL},
+  {Operator::add, -9223372036854775807LL, 0LL},
+  {Operator::add, 0LL, -9223372036854775807LL},
+  {Operator::add, -9223372036854775807LL, 0LL},
+  {Operator::add, 4611686018427387903LL, 4223372036854775807LL},
+  {Operator::add, -4611686018427387903LL, -4611686018427387903LL},
+  {Operator::add, 999377LL, -999023LL},
+  {Operator::add, -999359LL, 999983LL},
+  {Operator::modulus, 100LL, 100LL},
+  {Operator::modulus, 17LL, 1LL},
+  {Operator::modulus, 1LL, 10LL},
+  {Operator::modulus, 41LL, 1LL},
+  {Operator::modulus, 1000000000LL, 10LL},
+  {Operator::modulus, 37LL, 1000000000LL},
+  {Operator::modulus, 1000000000LL, 4000000000LL},
+  {Operator::modulus, 998681LL, 999983LL},
+  {Operator::modulus, 998681LL, 17LL},
+  {Operator::modulus, 999491999491LL, 11LL},
+  {Operator::modulus, 11LL, 999491999491LL},
+  {Operator::modulus, 11LL, 9146744073709551614LL},
+  {Operator::modulus, 9146744073709551614LL, 1LL},
+  {Operator::modulus, 9223372036854775807LL, 2LL},
+  {Operator::modulus, 9223372036854775807LL, 4LL},
+  {Operator::modulus, 9223372036854775807LL, 8LL},
+  {Operator::modulus, 9223372036854775807LL, 11LL},
+  {Operator::modulus, 9223372036854775807LL, 16LL},
+  {Operator::modulus, 9223372036854775607LL, 9223372036854775807LL},
+  {Operator::modulus, 9223372036854775807LL, 4611686018424387903LL},
+  {Operator::modulus, 9223372036824775807LL, 2305843009213693951LL},
+  {Operator::modulus, 998831LL, 1LL},
+  {Operator::modulus, 998831LL, -999809LL},
+  {Operator::modulus, -998917LL, -999809LL},
+  {Operator::modulus, -17LL, 1LL},
+  {Operator::modulus, 1LL, 10LL},
+  {Operator::modulus, -41LL, -1LL},
+  {Operator::modulus, -1000000000LL, 10LL},
+  {Operator::modulus, -37LL, 1000000000LL},
+  {Operator::modulus, -1000000000LL, 4000000000LL},
+  {Operator::modulus, -998681LL, 999983LL},
+  {Operator::modulus, -998681LL, 17LL},
+  {Operator::modulus, 999491999491LL, -11LL},
+  {Operator::modulus, -11LL, -999491999491LL},
+  {Operator::modulus, 0LL, 999491999491LL},
+  {Operator::modulus, 0LL, -999491999491LL},
+  {Operator::modulus, -11LL, 9146744073709551614LL},
+  {Operator::modulus, -9146744073709551614LL, 1LL},
+  {Operator::modulus, -9223372036854775807LL, 2LL},
+  {Operator::modulus, 9223372036854775807LL, -4LL},
+  {Operator::modulus, -9223372036854775807LL, 8LL},
+  {Operator::modulus, 9223372036854775807LL, -11LL},
+  {Operator::modulus, -9223372036854775807LL, 16LL},
+  {Operator::modulus, 9223372036834775807LL, -9223372036854775807LL},
+  {Operator::modulus, 922337203LL, 775807LL},
+  {Operator::modulus, 9223372036834775807LL, -54775807LL},
+  {Operator::modulus, -9223372036854775807LL, 4611686018427387903LL},
+  {Operator::modulus, -9223372036854775807LL, 84273LL},
+  {Operator::modulus, -9223372036854775807LL, 903LL},
+  {Operator::modulus, -9223372036854775807LL, 3LL},
+  {Operator::modulus, 9223372036854775807LL, -2305843009213693951LL},
+  {Operator::modulus, 2305843009213693951LL, -230LL},
+  {Operator::modulus, 2305843009213693951LL, -3LL},
+  {Operator::modulus, 2305843009213693951LL, -1LL},
+  {Operator::modulus, 0LL, -2305843009213693951LL},
+  {Operator::greater, 100LL, 100LL},
+  {Operator::greater, 100LL, 1LL},
+  {Operator::greater, 0LL, 100LL},
+  {Operator::greater, 1LL, 0LL},
+  {Operator::greater, 9223372036854775807LL, 9223372036854775807LL},
+  {Operator::greater, 2305843009213693951LL, 922337203685475807LL},
+  {Operator::greater, 922337203685477507LL, 9223372036854775807LL},
+  {Operator::greater, 2305843009213693951LL, 2305843009213693951LL},
+  {Operator::greater, 9223372036854775807LL, 0LL},
+  {Operator::greater, 9223372036854775807LL, 1LL},
+  {Operator::greater, 1LL, 9223372036854775807LL},
+  {Operator::greater, 0LL, 9223372036854775807LL},
+  {Operator::greater, -100LL, 1LL},
+  {Operator::greater, 0LL, -100LL},
+  {Operator::greater, -1LL, -0LL},
+  {Operator::greater, -9223372036854775807LL, -2305843009213693951LL},
+  {Operator::greater, -2305843009213693951LL, 9223372036854775807LL},
+  {Operator::greater, 9223372036854775807LL, -9223372036854775807LL},
+  {Operator::greater, 922337203854775807LL, -922337203685475807LL},
+  {Operator::greater, -9223372036854775807LL, -2305843009213693951LL},
+  {Operator::greater, -9223372036854775807LL, 0LL},
+  {Operator::greater, -9223372036854775807LL, 1LL},
+  {Operator::greater, -9223372036854775807LL, -1LL},
+  {Operator::greater, -1LL, -9223372036854775807LL},
+  {Operator::greater, 0LL, -9223372036854775807LL},
+  {Operator::greater_equal, 100LL, 100LL},
+  {Operator::greater_equal, 100LL, 1LL},
+  {Operator::greater_equal, 0LL, 100LL},
+  {Operator::greater_equal, 1LL, 0LL},
+  {Operator::greater_equal, 9223372036854775807LL, 9223372036854775807LL},
+  {Operator::greater_equal, 2305843009213693951LL, 922337203685475807LL},
+  {Operator::greater_equal, 922337203685477507LL, 9223372036854775807LL},
+  {Operator::greater_equal, 2305843009213693951LL, 2305843009213693951LL},
+  {Operator::greater_equal, 9223372036854775807LL, 0LL},
+  {Operator::greater_equal, 9223372036854775807LL, 1LL},
+  {Operator::greater_equal, 1LL, 9223372036854775807LL},
+  {Operator::greater_equal, 0LL, 9223372036854775807LL},
+  {Operator::greater_equal, -100LL, 1LL},
+  {Operator::greater_equal, 0LL, -100LL},
+  {Operator::greater_equal, -1LL, -0LL},
+  {Operator::greater_equal, -9223372036854775807LL, -2305843009213693951LL},
+  {Operator::greater_equal, -2305843009213693951LL, 9223372036854775807LL},
+  {Operator::greater_equal, 9223372036854775807LL, -9223372036854775807LL},
+  {Operator::greater_equal, 922337203854775807LL, -922337203685475807LL},
+  {Operator::greater_equal, -9223372036854775807LL, -2305843009213693951LL},
+  {Operator::greater_equal, -9223372036854775807LL, 0LL},
+  {Operator::greater_equal, -9223372036854775807LL, 1LL},
+  {Operator::greater_equal, -9223372036854775807LL, -1LL},
+  {Operator::greater_equal, -1LL, -9223372036854775807LL},
+  {Operator::greater_equal, 0LL, -9223372036854775807LL},
+  {Operator::less, 100LL, 100LL},
+  {Operator::less, 100LL, 1LL},
+  {Operator::less, 0LL, 100LL},
+  {Operator::less, 1LL, 0LL},
+  {Operator::less, 9223372036854775807LL, 9223372036854775807LL},
+  {Operator::less, 2305843009213693951LL, 922337203685475807LL},
+  {Operator::less, 922337203685477507LL, 9223372036854775807LL},
+  {Operator::less, 2305843009213693951LL, 2305843009213693951LL},
+  {Operator::less, 9223372036854775807LL, 0LL},
+  {Operator::less, 9223372036854775807LL, 1LL},
+  {Operator::less, 1LL, 9223372036854775807LL},
+  {Operator::less, 0LL, 9223372036854775807LL},
+  {Operator::less, -100LL, 1LL},
+  {Operator::less, 0LL, -100LL},
+  {Operator::less, -1LL, -0LL},
+  {Operator::less, -9223372036854775807LL, -2305843009213693951LL},
+  {Operator::less, -2305843009213693951LL, 9223372036854775807LL},
+  {Operator::less, 9223372036854775807LL, -9223372036854775807LL},
+  {Operator::less, 922337203854775807LL, -922337203685475807LL},
+  {Operator::less, -9223372036854775807LL, -2305843009213693951LL},
+  {Operator::less, -9223372036854775807LL, 0LL},
+  {Operator::less, -9223372036854775807LL, 1LL},
+  {Operator::less, -9223372036854775807LL, -1LL},
+  {Operator::less, -1LL, -9223372036854775807LL},
+  {Operator::less, 0LL, -9223372036854775807LL},
+  {Operator::less_equal, 100LL, 100LL},
+  {Operator::less_equal, 100LL, 1LL},
+  {Operator::less_equal, 0LL, 100LL},
+  {Operator::less_equal, 1LL, 0LL},
+  {Operator::less_equal, 9223372036854775807LL, 9223372036854775807LL},
+  {Operator::less_equal, 2305843009213693951LL, 922337203685475807LL},
+  {Operator::less_equal, 922337203685477507LL, 9223372036854775807LL},
+  {Operator::less_equal, 2305843009213693951LL, 2305843009213693951LL},
+  {Operator::less_equal, 9223372036854775807LL, 0LL},
+  {Operator::less_equal, 9223372036854775807LL, 1LL},
+  {Operator::less_equal, 1LL, 9223372036854775807LL},
+  {Operator::less_equal, 0LL, 9223372036854775807LL},
+  {Operator::less_equal, -100LL, 1LL},
+  {Operator::less_equal, 0LL, -100LL},
+  {Operator::less_equal, -1LL, -0LL},
+  {Operator::less_equal, -9223372036854775807LL, -2305843009213693951LL},
+  {Operator::less_equal, -2305843009213693951LL, 9223372036854775807LL},
+  {Operator::less_equal, 9223372036854775807LL, -9223372036854775807LL},
+  {Operator::less_equal, 922337203854775807LL, -922337203685475807LL},
+  {Operator::less_equal, -9223372036854775807LL, -2305843009213693951LL},
+  {Operator::less_equal, -9223372036854775807LL, 0LL},
+  {Operator::less_equal, -9223372036854775807LL, 1LL},
+  {Operator::less_equal, -9223372036854775807LL, -1LL},
+  {Operator::less_equal, -1LL, -9223372036854775807LL},
+  {Operator::less_equal, 0LL, -9223372036854775807LL}
+};
+
+constexpr Case<Float> f_cases[] = {
+  {Operator::equal, 1.0f, 1.0f},
+  {Operator::equal, 1234.567f, 765.4321f},
+  {Operator::equal,
+   3.1415926535897932384626433832795f,
+   3.141592653589793238462643383279f},
+  {Operator::equal, -123.0f, -768.0f},
+  {Operator::equal, 0.0f, -0.0f},
+  {Operator::equal, 1.0f, NAN},
+  {Operator::equal, NAN, 1.0f},
+  {Operator::equal, NAN, NAN},
+  {Operator::equal, INFINITY, 1.0f},
+  {Operator::equal, 0.0f, INFINITY},
+  {Operator::equal, -INFINITY, 0.0f},
+  {Operator::equal, 0.0f, -INFINITY},
+  {Operator::equal, INFINITY, INFINITY},
+  {Operator::equal, -INFINITY, -INFINITY},
+  {Operator::equal, INFINITY, -INFINITY},
+  {Operator::equal, -INFINITY, INFINITY},
+  {Operator::equal, -INFINITY, INFINITY},
+  {Operator::equal, 0.0f, HUGE_VALF},
+  {Operator::equal, 0.0f, -HUGE_VALF},
+  {Operator::equal, 0.0f, NAN},
+  {Operator::equal, -0.0f, HUGE_VALF},
+  {Operator::equal, -0.0f, -HUGE_VALF},
+  {Operator::equal, -0.0f, NAN},
+  {Operator::equal, NAN, HUGE_VALF},
+  {Operator::equal, NAN, -HUGE_VALF},
+  {Operator::equal, NAN, 3.14159f},
+  {Operator::equal, NAN, 3.14159f},
+  {Operator::equal, INFINITY, NAN},
+  {Operator::equal, -INFINITY, NAN},
+  {Operator::equal, INFINITY, HUGE_VALF},
+  {Operator::equal, -INFINITY, HUGE_VALF},
+  {Operator::equal, INFINITY, -HUGE_VALF},
+  {Operator::equal, -INFINITY, -HUGE_VALF},
+  {Operator::equal, 86400.0f, -HUGE_VALF},
+  {Operator::equal, 86400.0f, HUGE_VALF},
+  {Operator::equal, -86400.0f, HUGE_VALF},
+  {Operator::multiply, 1.0f, HUGE_VALF},
+  {Operator::multiply, -1.0f, HUGE_VALF},
+  {Operator::multiply, 1.0f, -HUGE_VALF},
+  {Operator::multiply, HUGE_VALF, INFINITY},
+  {Operator::multiply, HUGE_VALF, -INFINITY},
+  {Operator::multiply, -HUGE_VALF, -INFINITY},
+  {Operator::multiply, -HUGE_VALF, INFINITY},
+  {Operator::multiply, -2.25f, HUGE_VALF},
+  {Operator::multiply, HUGE_VALF, 12.0f},
+  {Operator::multiply, 0.5f, 10.0f},
+  {Operator::multiply, -0.5f, -2.0f},
+  {Operator::multiply, HUGE_VALF, 0.25f},
+  {Operator::multiply, -0.125f, HUGE_VALF},
+  {Operator::multiply, 0.0f, -0.0f},
+  {Operator::multiply, 0.0f, 1440.0f},
+  {Operator::multiply, -0.0f, 1440.0f},
+  {Operator::multiply, -1440.0f, 0.0f},
+  {Operator::multiply, 3.14159f, INFINITY},
+  {Operator::multiply, 3.14159f, -INFINITY},
+  {Operator::multiply, 3.14159f, -1.175494e-27f},
+  {Operator::multiply, 3.14159e+38f, -1.175494e-33f},
+  {Operator::multiply, -3.14159e+38f, -1.175494e-3f},
+  {Operator::multiply, 3.14159e-38f, -1.175494e-4f},
+  {Operator::divide, 0.0f, HUGE_VALF},
+  {Operator::divide, 0.0f, 8765.8765f},
+  {Operator::divide, 1.0f, HUGE_VALF},
+  {Operator::divide, 0.0f, 1.0f},
+  {Operator::divide, -1.0f, HUGE_VALF},
+  {Operator::divide, 1.0f, -HUGE_VALF},
+  {Operator::divide, -2.25f, HUGE_VALF},
+  {Operator::divide, HUGE_VALF, 1.0f},
+  {Operator::divide, HUGE_VALF, -1.0f},
+  {Operator::divide, -HUGE_VALF, 1.0f},
+  {Operator::divide, HUGE_VALF, -2.25f},
+  {Operator::divide, 0.5f, 10.0f},
+  {Operator::divide, -0.5f, -2.0f},
+  {Operator::divide, HUGE_VALF, 0.25f},
+  {Operator::divide, -0.125f, HUGE_VALF},
+  {Operator::divide, 1.0f, 1.0f},
+  {Operator::divide, 3.14159f, INFINITY},
+  {Operator::divide, 3.14159f, -INFINITY},
+  {Operator::divide, 3.14159f, 3.14159f},
+  {Operator::divide, 3.14159f, -INFINITY},
+  {Operator::divide, 3.14159f, 3.14159f},
+  {Operator::divide, 3.14159e+38f, -1.175494e-33f},
+  {Operator::divide, -3.14159e+38f, -1.175494e-3f},
+  {Operator::divide, 3.14159e-38f, -1.175494e-4f},
+  {Operator::divide, 13.14159e+18f, -13.175494e-33f},
+  {Operator::divide, -133.14159e+8f, -31.175494e-3f},
+  {Operator::divide, 83.14159e-38f, -1.175494e-4f},
+  {Operator::subtract, 100.0f, 100.0f},
+  {Operator::subtract, -0.125f, HUGE_VALF},
+  {Operator::subtract, -0.125f, HUGE_VALF},
+  {Operator::subtract, 1234.567f, 765.4321f},
+  {Operator::subtract,
+   3.1415926535897932384626433832795f,
+   3.141592653589793238462643383279f},
+  {Operator::subtract, -123.0f, -768.0f},
+  {Operator::subtract, 0.0f, -0.0f},
+  {Operator::subtract, INFINITY, 1.0f},
+  {Operator::subtract, 0.0f, INFINITY},
+  {Operator::subtract, -INFINITY, 0.0f},
+  {Operator::subtract, 0.0f, -INFINITY},
+  {Operator::subtract, INFINITY, -INFINITY},
+  {Operator::subtract, -INFINITY, INFINITY},
+  {Operator::subtract, -INFINITY, INFINITY},
+  {Operator::subtract, 0.0f, HUGE_VALF},
+  {Operator::subtract, 0.0f, -HUGE_VALF},
+  {Operator::subtract, -0.0f, HUGE_VALF},
+  {Operator::subtract, -0.0f, -HUGE_VALF},
+  {Operator::subtract, -INFINITY, HUGE_VALF},
+  {Operator::subtract, INFINITY, -HUGE_VALF},
+  {Operator::subtract, 86400.0f, -HUGE_VALF},
+  {Operator::subtract, 86400.0f, HUGE_VALF},
+  {Operator::subtract, -86400.0f, HUGE_VALF},
+  {Operator::subtract, 3.14159f, INFINITY},
+  {Operator::subtract, 3.14159f, -INFINITY},
+  {Operator::subtract, 3.14159f, 3.14159f},
+  {Operator::subtract, 3.14159f, -INFINITY},
+  {Operator::subtract, 3.14159f, 3.14159f},
+  {Operator::subtract, 3.14159e+28f, -1.175494e-5f},
+  {Operator::subtract, 3.14159e-18f, -1.175494e-4f},
+  {Operator::subtract, 13.14159e+18f, -13.175494e-33f},
+  {Operator::subtract, -133.14159e+11f, -31.175494e-3f},
+  {Operator::subtract, 83.14159e-28f, -1.175494e-4f},
+  {Operator::add, 100.0f, 100.0f},
+  {Operator::add, -0.125f, HUGE_VALF},
+  {Operator::add, 1234.567f, 765.4321f},
+  {Operator::add,
+   3.1415926535897932384626433832795f,
+   3.141592653589793238462643383279f},
+  {Operator::add, -123.0f, -768.0f},
+  {Operator::add, 0.0f, -0.0f},
+  {Operator::add, INFINITY, 1.0f},
+  {Operator::add, 0.0f, INFINITY},
+  {Operator::add, -INFINITY, 0.0f},
+  {Operator::add, 0.0f, -INFINITY},
+  {Operator::add, INFINITY, INFINITY},
+  {Operator::add, -INFINITY, -INFINITY},
+  {Operator::add, 0.0f, HUGE_VALF},
+  {Operator::add, 0.0f, -HUGE_VALF},
+  {Operator::add, -0.0f, HUGE_VALF},
+  {Operator::add, -0.0f, -HUGE_VALF},
+  {Operator::add, -INFINITY, -HUGE_VALF},
+  {Operator::add, 86400.0f, -HUGE_VALF},
+  {Operator::add, 86400.0f, HUGE_VALF},
+  {Operator::add, -86400.0f, HUGE_VALF},
+  {Operator::add, 3.14159f, INFINITY},
+  {Operator::add, 3.14159f, -INFINITY},
+  {Operator::add, 3.14159f, 3.14159f},
+  {Operator::add, 3.14159f, -INFINITY},
+  {Operator::add, 3.14159f, 3.14159f},
+  {Operator::add, 3.14159e+28f, -1.175494e-13f},
+  {Operator::add, -3.14159e+38f, -1.175494e-23f},
+  {Operator::add, 3.14159e-8f, -1.175494e-4f},
+  {Operator::add, 13.14159e+18f, -13.175494e-23f},
+  {Operator::add, -133.14159e+18f, -31.175494e-3f},
+  {Operator::add, 83.14159e-28f, -1.175494e-4f},
+  {Operator::greater, 100.0f, 100.0f},
+  {Operator::greater, HUGE_VALF, INFINITY},
+  {Operator::greater, INFINITY, HUGE_VALF},
+  {Operator::greater, INFINITY, NAN},
+  {Operator::greater, NAN, INFINITY},
+  {Operator::greater, HUGE_VALF, NAN},
+  {Operator::greater, NAN, HUGE_VALF},
+  {Operator::greater, HUGE_VALF, HUGE_VALF},
+  {Operator::greater, NAN, NAN},
+  {Operator::greater, INFINITY, INFINITY},
+  {Operator::greater, NAN, 0.0f},
+  {Operator::greater, HUGE_VALF, 0.0f},
+  {Operator::greater, INFINITY, 0.0f},
+  {Operator::greater, 0.0f, NAN},
+  {Operator::greater, 0.0f, HUGE_VALF},
+  {Operator::greater, 0.0f, INFINITY},
+  {Operator::greater, 0.0f, 0.0f},
+  {Operator::greater_equal, 100.0f, 100.0f},
+  {Operator::greater_equal, HUGE_VALF, INFINITY},
+  {Operator::greater_equal, INFINITY, HUGE_VALF},
+  {Operator::greater_equal, INFINITY, NAN},
+  {Operator::greater_equal, NAN, INFINITY},
+  {Operator::greater_equal, HUGE_VALF, NAN},
+  {Operator::greater_equal, NAN, HUGE_VALF},
+  {Operator::greater_equal, HUGE_VALF, HUGE_VALF},
+  {Operator::greater_equal, NAN, NAN},
+  {Operator::greater_equal, INFINITY, INFINITY},
+  {Operator::greater_equal, NAN, 0.0f},
+  {Operator::greater_equal, HUGE_VALF, 0.0f},
+  {Operator::greater_equal, INFINITY, 0.0f},
+  {Operator::greater_equal, 0.0f, NAN},
+  {Operator::greater_equal, 0.0f, HUGE_VALF},
+  {Operator::greater_equal, 0.0f, INFINITY},
+  {Operator::greater_equal, 0.0f, 0.0f},
+  {Operator::less, 100.0f, 100.0f},
+  {Operator::less, HUGE_VALF, INFINITY},
+  {Operator::less, INFINITY, HUGE_VALF},
+  {Operator::less, INFINITY, NAN},
+  {Operator::less, NAN, INFINITY},
+  {Operator::less, HUGE_VALF, NAN},
+  {Operator::less, NAN, HUGE_VALF},
+  {Operator::less, HUGE_VALF, HUGE_VALF},
+  {Operator::less, NAN, NAN},
+  {Operator::less, INFINITY, INFINITY},
+  {Operator::less, NAN, 0.0f},
+  {Operator::less, HUGE_VALF, 0.0f},
+  {Operator::less, INFINITY, 0.0f},
+  {Operator::less, 0.0f, NAN},
+  {Operator::less, 0.0f, HUGE_VALF},
+  {Operator::less, 0.0f, INFINITY},
+  {Operator::less, 0.0f, 0.0f},
+  {Operator::less_equal, 100.0f, 100.0f},
+  {Operator::less_equal, HUGE_VALF, INFINITY},
+  {Operator::less_equal, INFINITY, HUGE_VALF},
+  {Operator::less_equal, INFINITY, NAN},
+  {Operator::less_equal, NAN, INFINITY},
+  {Operator::less_equal, HUGE_VALF, NAN},
+  {Operator::less_equal, NAN, HUGE_VALF},
+  {Operator::less_equal, HUGE_VALF, HUGE_VALF},
+  {Operator::less_equal, NAN, NAN},
+  {Operator::less_equal, INFINITY, INFINITY},
+  {Operator::less_equal, NAN, 0.0f},
+  {Operator::less_equal, HUGE_VALF, 0.0f},
+  {Operator::less_equal, INFINITY, 0.0f},
+  {Operator::less_equal, 0.0f, NAN},
+  {Operator::less_equal, 0.0f, HUGE_VALF},
+  {Operator::less_equal, 0.0f, INFINITY},
+  {Operator::less_equal, 0.0f, 0.0f}
+};
+
+constexpr Case<Double> d_cases[] = {
+  {Operator::multiply, 100.0, 100.0},
+  {Operator::multiply, -0.125, HUGE_VAL},
+  {Operator::multiply, 0.125, HUGE_VAL},
+  {Operator::multiply, -HUGE_VAL, HUGE_VAL},
+  {Operator::multiply, HUGE_VAL, -HUGE_VAL},
+  {Operator::multiply, -1.0, HUGE_VALF},
+  {Operator::multiply, 1.0, -HUGE_VALF},
+  {Operator::multiply, HUGE_VALF, INFINITY},
+  {Operator::multiply, HUGE_VALF, -INFINITY},
+  {Operator::multiply, -HUGE_VALF, -INFINITY},
+  {Operator::multiply, -HUGE_VALF, INFINITY},
+  {Operator::multiply, -2.25, HUGE_VALF},
+  {Operator::multiply, HUGE_VALF, 12},
+  {Operator::multiply, 0.5, 10.0},
+  {Operator::multiply, -0.5, -2.0},
+  {Operator::multiply, HUGE_VALF, 0.25},
+  {Operator::multiply, 0.0, -0.0},
+  {Operator::multiply, 0.0, 1440.0},
+  {Operator::multiply, -0.0, 1440.0},
+  {Operator::multiply, -1440.0, 0.0},
+  {Operator::multiply, 3.14159, INFINITY},
+  {Operator::multiply, 3.14159, -INFINITY},
+  {Operator::multiply, 3.14159, -1.175494e-40},
+  {Operator::multiply, 3.14159e+48, -1.175494e-100},
+  {Operator::multiply, -3.14159e+68, -1.175494e-200},
+  {Operator::multiply, 3.14159e-38, -1.175494e-40},
+  {Operator::multiply, -3.14159e+48, 1.175494e-100},
+  {Operator::multiply, -3.14159e+68, 1.175494e-200},
+  {Operator::multiply, 3.14159e-38, -1.175494e+40},
+  {Operator::multiply, 3.14159e+38, -1.175494e+40},
+  {Operator::divide, 100.0, 100.0},
+  {Operator::divide, HUGE_VAL, -0.125},
+  {Operator::divide, 0.0, 8765.8765},
+  {Operator::divide, 1.0, HUGE_VALF},
+  {Operator::divide, 0.0, 1.0},
+  {Operator::divide, -1.0, HUGE_VALF},
+  {Operator::divide, 1.0, -HUGE_VALF},
+  {Operator::divide, -2.25, HUGE_VALF},
+  {Operator::divide, HUGE_VALF, INFINITY},
+  {Operator::divide, -HUGE_VALF, -INFINITY},
+  {Operator::divide, HUGE_VALF, 1.0},
+  {Operator::divide, HUGE_VALF, -1.0},
+  {Operator::divide, -HUGE_VALF, 1.0},
+  {Operator::divide, HUGE_VALF, -2.25},
+  {Operator::divide, 0.5, 10.0},
+  {Operator::divide, -0.5, -2.0},
+  {Operator::divide, HUGE_VALF, 0.25},
+  {Operator::divide, -0.125, HUGE_VALF},
+  {Operator::divide, 1.0, 1.0},
+  {Operator::divide, 3.14159, INFINITY},
+  {Operator::divide, 3.14159, -INFINITY},
+  {Operator::divide, 3.14159, 3.14159},
+  {Operator::divide, 3.14159, -INFINITY},
+  {Operator::divide, 3.14159, 3.14159},
+  {Operator::divide, 3.14159e+78, -1.175494e-53},
+  {Operator::divide, -3.14159e+78, -1.175494e-43},
+  {Operator::divide, 3.14159e-88, -1.175494e-40},
+  {Operator::divide, 13.14159e+18, -13.175494e-233},
+  {Operator::divide, -133.14159e+118, -31.175494e-3},
+  {Operator::divide, 83.14159e-288, -1.175494e-4},
+  {Operator::equal, 100.0, 100.0},
+  {Operator::equal, -0.125, HUGE_VAL},
+  {Operator::equal, 1234.567, 765.4321},
+  {Operator::equal,
+   3.1415926535897932384626433832795,
+   3.141592653589793238462643383279},
+  {Operator::equal, -123.0, -768.0},
+  {Operator::equal, 0.0, -0.0},
+  {Operator::equal, 1.0, NAN},
+  {Operator::equal, NAN, 1.0},
+  {Operator::equal, NAN, NAN},
+  {Operator::equal, INFINITY, 1.0},
+  {Operator::equal, 0.0, INFINITY},
+  {Operator::equal, -INFINITY, 0.0},
+  {Operator::equal, 0.0, -INFINITY},
+  {Operator::equal, INFINITY, INFINITY},
+  {Operator::equal, -INFINITY, -INFINITY},
+  {Operator::equal, INFINITY, -INFINITY},
+  {Operator::equal, -INFINITY, INFINITY},
+  {Operator::equal, -INFINITY, INFINITY},
+  {Operator::equal, 0.0, HUGE_VAL},
+  {Operator::equal, 0.0, -HUGE_VAL},
+  {Operator::equal, 0.0, NAN},
+  {Operator::equal, -0.0, HUGE_VAL},
+  {Operator::equal, -0.0, -HUGE_VAL},
+  {Operator::equal, -0.0, NAN},
+  {Operator::equal, NAN, HUGE_VAL},
+  {Operator::equal, NAN, -HUGE_VAL},
+  {Operator::equal, NAN, 3.14159},
+  {Operator::equal, NAN, 3.14159},
+  {Operator::equal, INFINITY, NAN},
+  {Operator::equal, -INFINITY, NAN},
+  {Operator::equal, INFINITY, HUGE_VAL},
+  {Operator::equal, -INFINITY, HUGE_VAL},
+  {Operator::equal, INFINITY, -HUGE_VAL},
+  {Operator::equal, -INFINITY, -HUGE_VAL},
+  {Operator::equal, 86400.0, -HUGE_VAL},
+  {Operator::equal, 86400.0, HUGE_VAL},
+  {Operator::equal, -86400.0, HUGE_VAL},
+  {Operator::equal, 3.14159, INFINITY},
+  {Operator::equal, 3.14159, -INFINITY},
+  {Operator::equal, 3.14159, 3.14159},
+  {Operator::equal, 3.14159, -INFINITY},
+  {Operator::equal, 3.14159, 3.14159},
+  {Operator::equal, 3.14159e+78, -1.175494e-53},
+  {Operator::equal, -3.14159e+78, -1.175494e-43},
+  {Operator::equal, 3.14159e-88, -1.175494e-40},
+  {Operator::equal, 13.14159e+18, -13.175494e-233},
+  {Operator::equal, -133.14159e+118, -31.175494e-3},
+  {Operator::equal, 83.14159e-288, -1.175494e-4},
+  {Operator::subtract, 100.0, 100.0},
+  {Operator::subtract, -0.125, HUGE_VAL},
+  {Operator::subtract, 1234.567, 765.4321},
+  {Operator::subtract,
+   3.1415926535897932384626433832795,
+   3.141592653589793238462643383279},
+  {Operator::subtract, -123.0, -768.0},
+  {Operator::subtract, 0.0, -0.0},
+  {Operator::subtract, INFINITY, 1.0},
+  {Operator::subtract, 0.0, INFINITY},
+  {Operator::subtract, -INFINITY, 0.0},
+  {Operator::subtract, 0.0, -INFINITY},
+  {Operator::subtract, INFINITY, INFINITY},
+  {Operator::subtract, -INFINITY, -INFINITY},
+  {Operator::subtract, INFINITY, -INFINITY},
+  {Operator::subtract, -INFINITY, INFINITY},
+  {Operator::subtract, -INFINITY, INFINITY},
+  {Operator::subtract, 0.0, HUGE_VAL},
+  {Operator::subtract, 0.0, -HUGE_VAL},
+  {Operator::subtract, -0.0, HUGE_VAL},
+  {Operator::subtract, -0.0, -HUGE_VAL},
+  {Operator::subtract, INFINITY, HUGE_VAL},
+  {Operator::subtract, -INFINITY, HUGE_VAL},
+  {Operator::subtract, INFINITY, -HUGE_VAL},
+  {Operator::subtract, -INFINITY, -HUGE_VAL},
+  {Operator::subtract, 86400.0, -HUGE_VAL},
+  {Operator::subtract, 86400.0, HUGE_VAL},
+  {Operator::subtract, -86400.0, HUGE_VAL},
+  {Operator::subtract, 3.14159, INFINITY},
+  {Operator::subtract, 3.14159, -INFINITY},
+  {Operator::subtract, 3.14159, 3.14159},
+  {Operator::subtract, 3.14159, -INFINITY},
+  {Operator::subtract, 3.14159, 3.14159},
+  {Operator::subtract, 3.14159e+78, -1.175494e-53},
+  {Operator::subtract, -3.14159e+78, -1.175494e-43},
+  {Operator::subtract, 3.14159e-88, -1.175494e-40},
+  {Operator::subtract, 13.14159e+18, -13.175494e-233},
+  {Operator::subtract, -133.14159e+118, -31.175494e-3},
+  {Operator::subtract, 83.14159e-288, -1.175494e-4},
+  {Operator::add, 100.0, 100.0},
+  {Operator::add, -0.125, HUGE_VAL},
+  {Operator::add, 1234.567, 765.4321},
+  {Operator::add,
+   3.1415926535897932384626433832795,
+   3.141592653589793238462643383279},
+  {Operator::add, -123.0, -768.0},
+  {Operator::add, 0.0, -0.0},
+  {Operator::add, INFINITY, 1.0},
+  {Operator::add, 0.0, INFINITY},
+  {Operator::add, -INFINITY, 0.0},
+  {Operator::add, 0.0, -INFINITY},
+  {Operator::add, INFINITY, INFINITY},
+  {Operator::add, -INFINITY, -INFINITY},
+  {Operator::add, INFINITY, -INFINITY},
+  {Operator::add, -INFINITY, INFINITY},
+  {Operator::add, -INFINITY, INFINITY},
+  {Operator::add, 0.0, HUGE_VAL},
+  {Operator::add, 0.0, -HUGE_VAL},
+  {Operator::add, -0.0, HUGE_VAL},
+  {Operator::add, -0.0, -HUGE_VAL},
+  {Operator::add, INFINITY, HUGE_VAL},
+  {Operator::add, -INFINITY, HUGE_VAL},
+  {Operator::add, INFINITY, -HUGE_VAL},
+  {Operator::add, -INFINITY, -HUGE_VAL},
+  {Operator::add, 86400.0, -HUGE_VAL},
+  {Operator::add, 86400.0, HUGE_VAL},
+  {Operator::add, -86400.0, HUGE_VAL},
+  {Operator::add, 3.14159, INFINITY},
+  {Operator::add, 3.14159, -INFINITY},
+  {Operator::add, 3.14159, 3.14159},
+  {Operator::add, 3.14159, -INFINITY},
+  {Operator::add, 3.14159, 3.14159},
+  {Operator::add, 3.14159e+78, -1.175494e-53},
+  {Operator::add, -3.14159e+78, -1.175494e-43},
+  {Operator::add, 3.14159e-88, -1.175494e-40},
+  {Operator::add, 13.14159e+18, -13.175494e-233},
+  {Operator::add, -133.14159e+118, -31.175494e-3},
+  {Operator::add, 83.14159e-288, -1.175494e-4},
+  {Operator::greater, 100.0, 100.0},
+  {Operator::greater, -0.125, HUGE_VAL},
+  {Operator::greater, HUGE_VAL, INFINITY},
+  {Operator::greater, INFINITY, HUGE_VAL},
+  {Operator::greater, INFINITY, NAN},
+  {Operator::greater, NAN, INFINITY},
+  {Operator::greater, HUGE_VAL, NAN},
+  {Operator::greater, NAN, HUGE_VAL},
+  {Operator::greater, HUGE_VAL, HUGE_VAL},
+  {Operator::greater, NAN, NAN},
+  {Operator::greater, INFINITY, INFINITY},
+  {Operator::greater, NAN, 0.0},
+  {Operator::greater, HUGE_VAL, 0.0},
+  {Operator::greater, INFINITY, 0.0},
+  {Operator::greater, 0.0, NAN},
+  {Operator::greater, 0.0, HUGE_VAL},
+  {Operator::greater, 0.0, INFINITY},
+  {Operator::greater, 0.0, 0.0},
+  {Operator::greater_equal, 100.0, 100.0},
+  {Operator::greater_equal, -0.125, HUGE_VAL},
+  {Operator::greater_equal, HUGE_VAL, INFINITY},
+  {Operator::greater_equal, INFINITY, HUGE_VAL},
+  {Operator::greater_equal, INFINITY, NAN},
+  {Operator::greater_equal, NAN, INFINITY},
+  {Operator::greater_equal, HUGE_VAL, NAN},
+  {Operator::greater_equal, NAN, HUGE_VAL},
+  {Operator::greater_equal, HUGE_VAL, HUGE_VAL},
+  {Operator::greater_equal, NAN, NAN},
+  {Operator::greater_equal, INFINITY, INFINITY},
+  {Operator::greater_equal, NAN, 0.0},
+  {Operator::greater_equal, HUGE_VAL, 0.0},
+  {Operator::greater_equal, INFINITY, 0.0},
+  {Operator::greater_equal, 0.0, NAN},
+  {Operator::greater_equal, 0.0, HUGE_VAL},
+  {Operator::greater_equal, 0.0, INFINITY},
+  {Operator::greater_equal, 0.0, 0.0},
+  {Operator::less, 100.0, 100.0},
+  {Operator::less, HUGE_VAL, -0.125},
+  {Operator::less, HUGE_VAL, INFINITY},
+  {Operator::less, INFINITY, HUGE_VAL},
+  {Operator::less, INFINITY, NAN},
+  {Operator::less, NAN, INFINITY},
+  {Operator::less, HUGE_VAL, NAN},
+  {Operator::less, NAN, HUGE_VAL},
+  {Operator::less, HUGE_VAL, HUGE_VAL},
+  {Operator::less, NAN, NAN},
+  {Operator::less, INFINITY, INFINITY},
+  {Operator::less, NAN, 0.0},
+  {Operator::less, HUGE_VAL, 0.0},
+  {Operator::less, INFINITY, 0.0},
+  {Operator::less, 0.0, NAN},
+  {Operator::less, 0.0, HUGE_VAL},
+  {Operator::less, 0.0, INFINITY},
+  {Operator::less, 0.0, 0.0},
+  {Operator::less_equal, 100.0, 100.0},
+  {Operator::less_equal, HUGE_VAL, -0.125},
+  {Operator::less_equal, HUGE_VAL, INFINITY},
+  {Operator::less_equal, INFINITY, HUGE_VAL},
+  {Operator::less_equal, INFINITY, NAN},
+  {Operator::less_equal, NAN, INFINITY},
+  {Operator::less_equal, HUGE_VAL, NAN},
+  {Operator::less_equal, NAN, HUGE_VAL},
+  {Operator::less_equal, HUGE_VAL, HUGE_VAL},
+  {Operator::less_equal, NAN, NAN},
+  {Operator::less_equal, INFINITY, INFINITY},
+  {Operator::less_equal, NAN, 0.0},
+  {Operator::less_equal, HUGE_VAL, 0.0},
+  {Operator::less_equal, INFINITY, 0.0},
+  {Operator::less_equal, 0.0, NAN},
+  {Operator::less_equal, 0.0, HUGE_VAL},
+  {Operator::less_equal, 0.0, INFINITY},
+  {Operator::less_equal, 0.0, 0.0}
+};
+
+constexpr Conversion<Float, Int> f_to_int_cases[] = {
+  0.4f, -1.1f, HUGE_VALF, -8.06f, -2.7e+2f, -2.7e-10f, -27272727272727.0f,
+  -2.7e+10f, 2.7e+10f, 18e+10f, 1386.0f, -1386.0f, INFINITY, 3.402823e+38f,
+  -1.175494e-38f, 0.0f
+};
+
+constexpr Conversion<Float, S64> f_to_s64_cases[] = {
+  0.4f, -1.1f, -8.06f, -1.175494e-38f, 0.0f
+};
+
+constexpr Conversion<Float, U64> f_to_u64_cases[] = {
+  0.4f, -1.175494e-38f, 0.0f, 2.2f, 12.7f
+};
+
+constexpr Conversion<Float, S32> f_to_s32_cases[] = {
+  0.4f, -1.1f, HUGE_VALF, -8.06f, INFINITY, 3.402823e+38f, -1.175494e-38f, 0.0f
+};
+
+constexpr Conversion<Float, U32> f_to_u32_cases[] = {
+  0.4f, -1.1f, HUGE_VALF, -8.06f, INFINITY, 3.402823e+38f, -1.175494e-38f, 0.0f
+};
+
+constexpr Conversion<Int, Float> int_to_f_cases[] = {
+  1, -1, 12, -12, 1000000, -1000000, 0xefff, 1234567, -1234567, 2034567,
+  -2034567
+};
+
+constexpr Conversion<S64, Float> s64_to_f_cases[] = {
+  0x7eeeeeeeffffff, 10000000, -10000000, 40000000, -40000000, 880000000,
+  -880000000
+};
+
+constexpr Conversion<U64, Float> u64_to_f_cases[] = {
+  12, 48, 1024, 8838, 0xffffffffffffffff, 0xeffffffffffffff,
+  0xfeefffffffff0000, 0x1234566789aabbcc
+};
+
+constexpr Conversion<S32, Float> s32_to_f_cases[] = {
+  12, -12, 156, -125, 2000000, -2000000, 1001111, -1000022
+};
+
+constexpr Conversion<U32, Float> u32_to_f_cases[] = {
+  48, 0, 1355678, 48567, 1, 1000000, 18456, 987654
+};
+
+constexpr Conversion<Double, Int> d_to_int_cases[] = {
+  0.4, -1.1, HUGE_VALF, -8.06, -2.7e+2, -2.7e-10, -27272727272727.0, -2.7e+10,
+  2.7e+10, 18e+10, 1386.0, -1386.0, INFINITY, 3.402823e+38, -1.175494e-38, 0.0
+};
+
+constexpr Conversion<Double, S64> d_to_s64_cases[] = {
+  0.4, -1.1, HUGE_VALF, -8.06, INFINITY, 3.402823e+38, -1.175494e-38, 0.0
+};
+
+constexpr Conversion<Double, U64> d_to_u64_cases[] = {
+  0.4, -1.1, HUGE_VALF, -8.06, INFINITY, 3.402823e+38, -1.175494e-38, 0.0
+};
+
+constexpr Conversion<Double, S32> d_to_s32_cases[] = {
+  0.4, -1.1, HUGE_VALF, -8.06, INFINITY, 3.402823e+38, -1.175494e-38, 0.0
+};
+
+constexpr Conversion<Double, U32> d_to_u32_cases[] = {
+  0.4, -1.1, HUGE_VALF, -8.06, INFINITY, 3.402823e+38, -1.175494e-38, 0.0
+};
+
+constexpr Conversion<Int, Double> int_to_d_cases[] = {
+  1, -1, 12, -12, 1000000, -1000000, 0xefff, 1234567, -1234567, 2034567,
+  -2034567
+};
+
+constexpr Conversion<S64, Double> s64_to_d_cases[] = {
+  0x7eeeeeeeffffffff, 0xfeeeeeeeffffffff, 10000000, -10000000, 40000000,
+  -40000000, 880000000, -880000000
+};
+
+constexpr Conversion<U64, Double> u64_to_d_cases[] = {
+  12, 48, 1024, 8838, 0xffffffffffffffff, 0xeffffffffffffff,
+  0xfeefffffffff0000, 0x1234566789aabbcc
+};
+
+constexpr Conversion<S32, Double> s32_to_d_cases[] = {
+  12, -12, 156, -125, 2000000, -2000000, 1001111, -1000022
+};
+
+constexpr Conversion<U32, Double> u32_to_d_cases[] = {
+  48, 0, 1355678, 48567, 1, 1000000, 18456, 987654
+};
+
+// runs on the target, the operands arrive at run time so nothing is folded
+template <typename T, Operator op>
+int operation(operand_t a, operand_t b, operand_t result) {
+  const typename T::type value = apply(op, a.*T::member, b.*T::member);
+  if constexpr (is_comparison(op)) {
+    return int(value) == result.op_int;
+  } else if constexpr (!std::numeric_limits<typename T::type>::is_integer) {
+    // NaN compares unequal to everything, any NaN is the expected result
+    if (is_nan(result.*T::member)) {
+      return is_nan(value);
+    }
+    return value == result.*T::member;
+  } else {
+    return value == result.*T::member;
+  }
+}
+
+template <typename From, typename To>
+int conversion(operand_t a, operand_t b, operand_t result) {
+  (void)b;
+  return static_cast<typename To::type>(a.*From::member) == result.*To::member;
+}
+
+template <typename T> op operation_function(Operator value) {
+  switch (value) {
+  case Operator::add:
+    return operation<T, Operator::add>;
+  case Operator::subtract:
+    return operation<T, Operator::subtract>;
+  case Operator::multiply:
+    return operation<T, Operator::multiply>;
+  case Operator::divide:
+    return operation<T, Operator::divide>;
+  case Operator::modulus:
+    return operation<T, Operator::modulus>;
+  case Operator::shift_left:
+    return operation<T, Operator::shift_left>;
+  case Operator::shift_right:
+    return operation<T, Operator::shift_right>;
+  case Operator::equal:
+    return operation<T, Operator::equal>;
+  case Operator::greater:
+    return operation<T, Operator::greater>;
+  case Operator::greater_equal:
+    return operation<T, Operator::greater_equal>;
+  case Operator::less:
+    return operation<T, Operator::less>;
+  case Operator::less_equal:
+    return operation<T, Operator::less_equal>;
+  }
+  return nullptr;
+}
+
+// in Operator order
+constexpr const char *operator_names[] = {
+  "add",
+  "sub",
+  "mul",
+  "div",
+  "modulus",
+  "shift_to_left",
+  "shift_to_right",
+  "cmp",
+  "greaterthan",
+  "greaterthanorequal",
+  "lessthan",
+  "lessthanorequal"};
+
+constexpr const char *operator_strings[] =
+  {"+", "-", "*", "/", "%", "<<", ">>", "==", ">", ">=", "<", "<="};
+
+static_assert(std::size(operator_names) == u32(Operator::less_equal) + 1);
+static_assert(std::size(operator_strings) == std::size(operator_names));
+
+template <typename T, size_t size>
+void format(char (&buffer)[size], typename T::type value) {
+  using type = typename T::type;
+  if constexpr (std::is_same_v<type, float>) {
+    snprintf(buffer, size, "%.9g", double(value));
+  } else if constexpr (std::is_same_v<type, double>) {
+    snprintf(buffer, size, "%.17g", value);
+  } else if constexpr (sizeof(type) == sizeof(u64)) {
+    snprintf(
+      buffer,
+      size,
+      "0x%08lx%08lx",
+      (unsigned long)(u64(value) >> 32),
+      (unsigned long)(u64(value) & 0xffffffff));
+  } else if constexpr (std::is_signed_v<type>) {
+    snprintf(buffer, size, "%ld", long(value));
+  } else {
+    snprintf(buffer, size, "%lu", (unsigned long)value);
+  }
+}
+
+template <typename T> void fill(const Case<T> &entry, test_t *test) {
+  const u32 op_idx = u32(entry.op);
+  snprintf(
+    test->name,
+    sizeof(test->name),
+    "%s_%s",
+    operator_names[op_idx],
+    T::name);
+  format<T>(test->a_str, entry.a);
+  format<T>(test->b_str, entry.b);
+  test->op_str = operator_strings[op_idx];
+  test->operation = operation_function<T>(entry.op);
+  test->a.*T::member = entry.a;
+  test->b.*T::member = entry.b;
+  if (is_comparison(entry.op)) {
+    test->result.op_int = int(entry.result);
+  } else {
+    test->result.*T::member = entry.result;
+  }
+  test->o_execute_flags = T::flag | operator_flag(entry.op);
+}
+
+template <typename From, typename To>
+void fill(const Conversion<From, To> &entry, test_t *test) {
+  snprintf(test->name, sizeof(test->name), "%s_to_%s", From::name, To::name);
+  format<From>(test->a_str, entry.a);
+  strcpy(test->b_str, "--");
+  test->op_str = " cast ";
+  test->operation = conversion<From, To>;
+  test->a.*From::member = entry.a;
+  test->result.*To::member = entry.result;
+  // casts are grouped by their floating point side
+  test->o_execute_flags =
+    TYPE_CAST_TEST_FLAG
+    | (std::is_floating_point_v<typename From::type> ? From::flag : To::flag);
+}
+
+struct Table {
+  u32 count;
+  void (*get)(u32 idx, test_t *test);
+};
+
+template <const auto &cases> constexpr u32 supported_count() {
+  u32 result = 0;
+  for (const auto &entry : cases) {
+    result += is_supported(entry) ? 1 : 0;
+  }
+  return result;
+}
+
+// unsupported cases are skipped so the numbering has no gaps
+template <const auto &cases> constexpr Table table() {
+  return {supported_count<cases>(), [](u32 idx, test_t *test) {
+            for (const auto &entry : cases) {
+              if (is_supported(entry) && idx-- == 0) {
+                fill(entry, test);
+                return;
+              }
+            }
+          }};
+}
+
+// in the order the cases are numbered
+constexpr Table tables[] = {
+  table<u64_cases>(),
+  table<s64_cases>(),
+  table<f_cases>(),
+  table<d_cases>(),
+  table<f_to_int_cases>(),
+  table<f_to_s64_cases>(),
+  table<f_to_u64_cases>(),
+  table<f_to_s32_cases>(),
+  table<f_to_u32_cases>(),
+  table<int_to_f_cases>(),
+  table<s64_to_f_cases>(),
+  table<u64_to_f_cases>(),
+  table<s32_to_f_cases>(),
+  table<u32_to_f_cases>(),
+  table<d_to_int_cases>(),
+  table<d_to_s64_cases>(),
+  table<d_to_u64_cases>(),
+  table<d_to_s32_cases>(),
+  table<d_to_u32_cases>(),
+  table<int_to_d_cases>(),
+  table<s64_to_d_cases>(),
+  table<u64_to_d_cases>(),
+  table<s32_to_d_cases>(),
+  table<u32_to_d_cases>()};
+
+} // namespace
+
+int num_test_get(u32 idx, test_t *test) {
+  for (const Table &entry : tables) {
+    if (idx < entry.count) {
+      *test = test_t();
+      entry.get(idx, test);
+      return 0;
+    }
+    idx -= entry.count;
+  }
+  return -1;
+}
+
+u32 num_test_count() {
+  u32 result = 0;
+  for (const Table &entry : tables) {
+    result += entry.count;
+  }
+  return result;
+}
+
+int num_test_execute(u32 o_flags, u32 o_execute_flags) {
+  const u32 type_flags = ~u32(EXECUTE_ALL_TEST_FLAG);
+  test_t test;
+  for (u32 i = 0; num_test_get(i, &test) == 0; i++) {
+    if (
+      (test.o_execute_flags & o_flags & type_flags)
+      && (test.o_execute_flags & o_execute_flags & EXECUTE_ALL_TEST_FLAG)) {
+      printf(
+        "test %s %s%s%s...",
+        test.name,
+        test.a_str,
+        test.op_str,
+        test.b_str);
+      fflush(stdout);
+      if (test.operation(test.a, test.b, test.result) == 0) {
+        printf("failed\n");
+      } else {
+        printf("passed\n");
+      }
+    }
+  }
+  return 0;
+}
@@ -41,11 +41,11 @@ typedef union {
 
 typedef int (*op)(operand_t, operand_t, operand_t);
 
+// filled in by num_test_get() from the generated tables (num_table.hpp)
 typedef struct {
-  const char *name;
-  const char *a_str;
-  const char *a_str_type;
-  const char *b_str;
+  char name[32];
+  char a_str[32];
+  char b_str[32];
   const char *op_str;
   op operation;
   operand_t a;
@@ -60,7 +60,8 @@ extern "C" {
 
 int num_test_execute(u32 o_flags, u32 o_execute_flags);
 
-const test_t *num_test_get(u32 idx);
+// returns -1 when idx is past the end
+int num_test_get(u32 idx, test_t *test);
 u32 num_test_count();
 
 #if defined __cplusplus
@@ -0,0 +1,58 @@
+// Copyright 2011-2021 Tyler Gilbert and Stratify Labs, Inc; see LICENSE.md
+
+#ifndef FASTSEMAPHORE_HPP
+#define FASTSEMAPHORE_HPP
+
+#include <atomic>
+
+#include <thread/Semaphore.hpp>
+
+// Counting semaphore that stays in user space unless a thread must block.
+//
+// The count lives in an atomic. post() and wait() adjust it with one atomic
+// operation and only touch the kernel semaphore when the count says a
+// thread is, or is about to be, blocked: wait() takes the count below zero
+// and sleeps on the kernel semaphore, post() finds the count below zero and
+// wakes one sleeper. A negative count is the number of blocked threads.
+class FastSemaphore {
+public:
+  explicit FastSemaphore(s32 value = 0)
+    : m_count(value),
+      m_semaphore(thread::UnnamedSemaphore::ProcessShared::no, 0) {}
+
+  FastSemaphore &wait() {
+    if (m_count.fetch_sub(1, std::memory_order_acquire) <= 0) {
+      m_semaphore.wait();
+    }
+    return *this;
+  }
+
+  // false instead of blocking when the count is zero
+  bool try_wait() {
+    s32 count = m_count.load(std::memory_order_relaxed);
+    while (count > 0) {
+      if (m_count.compare_exchange_weak(count, count - 1,
+                                        std::memory_order_acquire,
+                                        std::memory_order_relaxed)) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  FastSemaphore &post() {
+    if (m_count.fetch_add(1, std::memory_order_release) < 0) {
+      m_semaphore.post();
+    }
+    return *this;
+  }
+
+  s32 get_value() const { return m_count.load(std::memory_order_relaxed); }
+
+private:
+  std::atomic<s32> m_count;
+  // only holds a count while a post() races ahead of the wait() it wakes
+  thread::UnnamedSemaphore m_semaphore;
+};
+
+#endif // FASTSEMAPHORE_HPP
@@ -0,0 +1,153 @@
+// Copyright 2011-2021 Tyler Gilbert and Stratify Labs, Inc; see LICENSE.md
+
+#ifndef LOCKFREEQUEUE_HPP
+#define LOCKFREEQUEUE_HPP
+
+#include <atomic>
+
+#include <sdk/types.h>
+
+// Bounded queues that pass values between threads without a system call.
+//
+// Neither queue blocks: push() returns false when the queue is full and
+// pop() returns false when it is empty, the caller decides whether to spin,
+// yield or sleep. Capacity must be a power of two so the indexes are free
+// running counters that are masked (wrap-around is harmless).
+//
+// The indexes are aligned to separate cache lines (32 bytes on Cortex-M7)
+// so the producer and consumer do not invalidate each other's line on every
+// push and pop.
+namespace lock_free {
+
+constexpr u32 cache_line_size = 32;
+
+// One producer thread and one consumer thread.
+//
+// The tail is written only by the producer and the head only by the
+// consumer, so each operation is a copy and one release store.
+template <typename T, u32 Capacity> class SpscRing {
+  static_assert(Capacity && (Capacity & (Capacity - 1)) == 0,
+                "Capacity must be a power of two");
+
+public:
+  bool push(const T &value) {
+    const u32 tail = m_tail.load(std::memory_order_relaxed);
+    if (tail - m_head.load(std::memory_order_acquire) == Capacity) {
+      return false;
+    }
+    m_buffer[tail & mask] = value;
+    m_tail.store(tail + 1, std::memory_order_release);
+    return true;
+  }
+
+  bool pop(T &value) {
+    const u32 head = m_head.load(std::memory_order_relaxed);
+    if (m_tail.load(std::memory_order_acquire) == head) {
+      return false;
+    }
+    value = m_buffer[head & mask];
+    m_head.store(head + 1, std::memory_order_release);
+    return true;
+  }
+
+  // only a snapshot while other threads are pushing or popping
+  u32 count() const {
+    return m_tail.load(std::memory_order_acquire) -
+           m_head.load(std::memory_order_acquire);
+  }
+
+  static constexpr u32 capacity() { return Capacity; }
+
+private:
+  static constexpr u32 mask = Capacity - 1;
+
+  alignas(cache_line_size) std::atomic<u32> m_head{0};
+  alignas(cache_line_size) std::atomic<u32> m_tail{0};
+  alignas(cache_line_size) T m_buffer[Capacity];
+};
+
+// Any number of producer and consumer threads.
+//
+// Each cell carries a sequence number. A producer may fill the cell at
+// position p when its sequence is p and publishes it as p + 1; a consumer
+// may empty it when the sequence is p + 1 and releases it for the next lap
+// as p + Capacity. Producers and consumers claim positions with a
+// compare-exchange on the tail and head, so a thread preempted between the
+// claim and the publish delays only the threads waiting on that one cell.
+template <typename T, u32 Capacity> class MpmcQueue {
+  static_assert(Capacity && (Capacity & (Capacity - 1)) == 0,
+                "Capacity must be a power of two");
+
+public:
+  MpmcQueue() {
+    for (u32 i = 0; i < Capacity; i++) {
+      m_cells[i].sequence.store(i, std::memory_order_relaxed);
+    }
+  }
+
+  bool push(const T &value) {
+    u32 position = m_tail.load(std::memory_order_relaxed);
+    Cell *cell;
+    while (true) {
+      cell = m_cells + (position & mask);
+      const u32 sequence = cell->sequence.load(std::memory_order_acquire);
+      const s32 difference = s32(sequence - position);
+      if (difference == 0) {
+        if (m_tail.compare_exchange_weak(position, position + 1,
+                                         std::memory_order_relaxed)) {
+          break;
+        }
+      } else if (difference < 0) {
+        // the consumer has not emptied this cell since the last lap
+        return false;
+      } else {
+        position = m_tail.load(std::memory_order_relaxed);
+      }
+    }
+    cell->value = value;
+    cell->sequence.store(position + 1, std::memory_order_release);
+    return true;
+  }
+
+  bool pop(T &value) {
+    u32 position = m_head.load(std::memory_order_relaxed);
+    Cell *cell;
+    while (true) {
+      cell = m_cells + (position & mask);
+      const u32 sequence = cell->sequence.load(std::memory_order_acquire);
+      const s32 difference = s32(sequence - (position + 1));
+      if (difference == 0) {
+        if (m_head.compare_exchange_weak(position, position + 1,
+                                         std::memory_order_relaxed)) {
+          break;
+        }
+      } else if (difference < 0) {
+        // no producer has published this cell yet
+        return false;
+      } else {
+        position = m_head.load(std::memory_order_relaxed);
+      }
+    }
+    value = cell->value;
+    cell->sequence.store(position + Capacity, std::memory_order_release);
+    return true;
+  }
+
+  static constexpr u32 capacity() { return Capacity; }
+
+private:
+  static constexpr u32 mask = Capacity - 1;
+
+  struct Cell {
+    std::atomic<u32> sequence;
+    T value;
+  };
+
+  alignas(cache_line_size) std::atomic<u32> m_head{0};
+  alignas(cache_line_size) std::atomic<u32> m_tail{0};
+  alignas(cache_line_size) Cell m_cells[Capacity];
+};
+
+} // namespace lock_free
+
+#endif // LOCKFREEQUEUE_HPP
@@ -1,13 +1,274 @@
 // Copyright 2011-2021 Tyler Gilbert and Stratify Labs, Inc; see LICENSE.md
 
+#include <cstring>
+
 #include <chrono.hpp>
 #include <test/Case.hpp>
 #include <thread.hpp>
 #include <var.hpp>
 
+#include "CliOption.hpp"
+#include "Histogram.hpp"
+#include "LockFreeQueue.hpp"
 #include "MqTest.hpp"
+#include "ResultArchive.hpp"
+#include "SlabChannel.hpp"
+#include "WorkerPool.hpp"
+
+namespace {
+
+// the start of every benchmark message, the rest is payload
+struct MessageHeader {
+  u32 sequence;
+  // microseconds since the run started, for the one-way latency
+  u32 timestamp;
+  u32 priority;
+};
+
+// the lock-free queues hold the MessageBuffer size of the api case
+using QueueMessage = Array<u8, 32>;
+
+// messages each queue holds before send() waits in the queue comparison
+constexpr u32 queue_depth = 16;
+
+// frames each transport holds before the producer waits
+constexpr u32 frame_depth = 4;
+
+// every fourth message is urgent when priorities are mixed
+constexpr u32 urgent_priority = 1;
+constexpr u32 urgent_interval = 4;
+
+// send() and receive() return once the message has been passed, thread is
+// the index of the calling producer or consumer
+//
+// An Mq object holds the priority of the next send and of the last message
+// received, so the channel opens the queue once per thread pair for
+// receiving and once per pair and priority for sending. No Mq object is
+// shared between threads.
+class MqChannel {
+public:
+  static constexpr u32 maximum_thread_count = 2;
+
+  explicit MqChannel(StringView name)
+    : m_endpoints{Endpoint(name), Endpoint(name)} {}
+
+  // priority is 0 or urgent_priority
+  bool send(u32 thread, const void *message, u32 size, u32 priority) {
+    if (thread >= maximum_thread_count) {
+      return false;
+    }
+    Endpoint &endpoint = m_endpoints[thread];
+    return (priority == urgent_priority ? endpoint.urgent_mq
+                                        : endpoint.send_mq)
+      .send(View(message, size))
+      .is_success();
+  }
+
+  bool receive(u32 thread, void *message, u32 size) {
+    if (thread >= maximum_thread_count) {
+      return false;
+    }
+    return m_endpoints[thread]
+      .receive_mq.receive(View(message, size))
+      .is_success();
+  }
+
+private:
+  struct Endpoint {
+    explicit Endpoint(StringView name)
+      : receive_mq(name), send_mq(name), urgent_mq(name) {
+      send_mq.set_message_priority(0);
+      urgent_mq.set_message_priority(urgent_priority);
+    }
+
+    Mq receive_mq;
+    Mq send_mq;
+    Mq urgent_mq;
+  };
+
+  Endpoint m_endpoints[maximum_thread_count];
+};
+
+// the lock-free queues never block, waiting yields the processor so a
+// producer and a consumer at the same priority take turns
+template <class Queue> class QueueChannel {
+public:
+  // all messages have the same priority
+  bool send(u32, const void *message, u32 size, u32) {
+    if (size > sizeof(QueueMessage)) {
+      return false;
+    }
+    QueueMessage queue_message;
+    memcpy(queue_message.data(), message, size);
+    while (m_queue.push(queue_message) == false) {
+      Sched().yield();
+    }
+    return true;
+  }
+
+  bool receive(u32, void *message, u32 size) {
+    if (size > sizeof(QueueMessage)) {
+      return false;
+    }
+    QueueMessage queue_message;
+    while (m_queue.pop(queue_message) == false) {
+      Sched().yield();
+    }
+    memcpy(message, queue_message.data(), size);
+    return true;
+  }
+
+private:
+  Queue m_queue;
+};
+
+// One producer thread writes frames and one consumer thread reads them.
+//
+// The producer writes every byte of each frame and the consumer checks the
+// first and the last, as a camera or audio driver and its client would. Mq
+// copies the frame into and out of the kernel, SlabChannel moves only the
+// slab handle.
+class FrameTransfer {
+public:
+  FrameTransfer(u32 frame_count, u32 frame_size)
+    : m_frame_count(frame_count), m_frame_size(frame_size) {}
+
+  // either both Mq handles (the producer and the consumer each use their
+  // own) or slab_channel is null
+  FrameTransfer &execute(Mq *send_mq, Mq *receive_mq,
+                         SlabChannel *slab_channel) {
+    m_send_mq = send_mq;
+    m_receive_mq = receive_mq;
+    m_slab_channel = slab_channel;
+
+    WorkerPool pool(2);
+    pool.add(this, consume).add(this, produce);
+
+    m_clock.start();
+    pool.start();
+    pool.join();
+    m_clock.stop();
+    return *this;
+  }
+
+  bool is_complete() const { return m_is_produced && m_is_consumed; }
+  u32 error_count() const { return m_error_count; }
+  u32 duration_us() const { return m_clock.microseconds(); }
+  const Histogram &latency_histogram() const { return m_latency_histogram; }
+
+private:
+  Mq *m_send_mq = nullptr;
+  Mq *m_receive_mq = nullptr;
+  SlabChannel *m_slab_channel = nullptr;
+  ClockTimer m_clock;
+  u32 m_frame_count;
+  u32 m_frame_size;
+  Histogram m_latency_histogram;
+  u32 m_error_count = 0;
+  bool m_is_produced = false;
+  bool m_is_consumed = false;
+
+  void write_frame(void *frame, u32 sequence) {
+    auto *bytes = reinterpret_cast<u8 *>(frame);
+    memset(bytes, u8(sequence), m_frame_size);
+    MessageHeader header;
+    header.sequence = sequence;
+    header.priority = 0;
+    header.timestamp = m_clock.microseconds();
+    memcpy(bytes, &header, sizeof(header));
+  }
+
+  void read_frame(const void *frame, u32 sequence) {
+    const auto *bytes = reinterpret_cast<const u8 *>(frame);
+    MessageHeader header;
+    memcpy(&header, bytes, sizeof(header));
+    m_latency_histogram.add(m_clock.microseconds() - header.timestamp);
+    if (header.sequence != sequence ||
+        bytes[m_frame_size - 1] != u8(sequence)) {
+      m_error_count++;
+    }
+  }
 
-MqTest::MqTest() : test::Test("posix::mq") {}
+  static void *produce(void *args) {
+    auto *self = reinterpret_cast<FrameTransfer *>(args);
+    if (self->m_slab_channel) {
+      for (u32 i = 0; i < self->m_frame_count; i++) {
+        auto slab = self->m_slab_channel->acquire();
+        self->write_frame(self->m_slab_channel->data(slab), i);
+        slab.size = self->m_frame_size;
+        self->m_slab_channel->send(slab);
+      }
+    } else {
+      Vector<u8> frame;
+      frame.resize(self->m_frame_size);
+      for (u32 i = 0; i < self->m_frame_count; i++) {
+        self->write_frame(frame.data(), i);
+        if (self->m_send_mq->send(View(frame.data(), frame.count()))
+              .is_error()) {
+          return nullptr;
+        }
+      }
+    }
+    self->m_is_produced = true;
+    return nullptr;
+  }
+
+  static void *consume(void *args) {
+    auto *self = reinterpret_cast<FrameTransfer *>(args);
+    if (self->m_slab_channel) {
+      for (u32 i = 0; i < self->m_frame_count; i++) {
+        const auto slab = self->m_slab_channel->receive();
+        self->read_frame(self->m_slab_channel->data(slab), i);
+        self->m_slab_channel->release(slab);
+      }
+    } else {
+      Vector<u8> frame;
+      frame.resize(self->m_frame_size);
+      for (u32 i = 0; i < self->m_frame_count; i++) {
+        if (self->m_receive_mq->receive(View(frame.data(), frame.count()))
+              .is_error()) {
+          return nullptr;
+        }
+        self->read_frame(frame.data(), i);
+      }
+    }
+    self->m_is_consumed = true;
+    return nullptr;
+  }
+};
+
+} // namespace
+
+MqTest::Options::Options(const Cli &cli) {
+  set_message_count(parse_u32_option(
+    cli,
+    "mqMessages",
+    "messages passed through each queue when benchmarking (default 10000)",
+    message_count()));
+  set_maximum_message_size(parse_u32_option(
+    cli,
+    "mqMaxSize",
+    "largest message size of the Mq sweep in bytes (default 1024)",
+    maximum_message_size()));
+  set_maximum_depth(parse_u32_option(
+    cli,
+    "mqMaxDepth",
+    "largest maximum message count of the Mq sweep (default 16)",
+    maximum_depth()));
+  set_frame_count(parse_u32_option(
+    cli,
+    "mqFrames",
+    "large frames passed through each transport (default 1000)",
+    frame_count()));
+  set_maximum_frame_size(parse_u32_option(
+    cli,
+    "mqMaxFrameSize",
+    "largest frame size in bytes, up to 65536 with enough RAM (default 4096)",
+    maximum_frame_size()));
+}
+
+MqTest::MqTest(const Options &options)
+  : test::Test("posix::mq"), m_options(options) {}
 
 bool MqTest::execute_class_api_case() {
 
@@ -195,3 +456,336 @@ bool MqTest::execute_class_api_case() {
 
   return case_result();
 }
+
+bool MqTest::execute_class_performance_case() {
+  TEST_ASSERT(m_options.message_count() > 0);
+  TEST_ASSERT(m_options.maximum_message_size() >= sizeof(MessageHeader));
+  TEST_ASSERT(m_options.maximum_depth() > 0);
+
+  {
+    api::ErrorScope error_scope;
+    if (Mq("mq1").is_success()) {
+      Mq::unlink("mq1");
+    }
+  }
+
+  // Mq across message sizes and queue depths, one producer and one consumer
+  for (u32 message_size = 16;
+       message_size <= m_options.maximum_message_size();
+       message_size *= 4) {
+    for (u32 depth = 1; depth <= m_options.maximum_depth(); depth *= 4) {
+      Mq mq(Mq::Attributes()
+              .set_maximum_message_count(depth)
+              .set_message_size(message_size),
+            Mq::IsExclusive::yes, "mq1");
+      TEST_ASSERT(is_success());
+
+      // mq creates the queue, the channel opens its own handles to it
+      MqChannel channel("mq1");
+      TEST_ASSERT(is_success());
+      const auto name = "mq" | NumberString(message_size, "%ldBytes") |
+                        NumberString(depth, "Depth%ld");
+      for (const auto is_priority_mixed :
+           {IsPriorityMixed::no, IsPriorityMixed::yes}) {
+        TEST_EXPECT(execute_class_channel_performance_case(
+          name | (is_priority_mixed == IsPriorityMixed::yes ? "Mixed" : ""),
+          channel,
+          ChannelRun()
+            .set_thread_count(1)
+            .set_message_size(message_size)
+            .set_priority_mixed(is_priority_mixed)));
+      }
+      Mq::unlink("mq1");
+    }
+  }
+
+  // Mq against the lock-free queues with MessageBuffer size messages
+  const auto queue_run = ChannelRun().set_message_size(sizeof(QueueMessage));
+  {
+    Mq mq(Mq::Attributes()
+            .set_maximum_message_count(queue_depth)
+            .set_message_size(sizeof(QueueMessage)),
+          Mq::IsExclusive::yes, "mq1");
+    TEST_ASSERT(is_success());
+
+    MqChannel channel("mq1");
+    TEST_ASSERT(is_success());
+    TEST_EXPECT(execute_class_channel_performance_case(
+      "mq1Pairs", channel, ChannelRun(queue_run).set_thread_count(1)));
+    TEST_EXPECT(execute_class_channel_performance_case(
+      "mq2Pairs", channel, ChannelRun(queue_run).set_thread_count(2)));
+    Mq::unlink("mq1");
+  }
+
+  {
+    QueueChannel<lock_free::SpscRing<QueueMessage, queue_depth>> channel;
+    TEST_EXPECT(execute_class_channel_performance_case(
+      "spsc1Pairs", channel, ChannelRun(queue_run).set_thread_count(1)));
+  }
+
+  {
+    QueueChannel<lock_free::MpmcQueue<QueueMessage, queue_depth>> channel;
+    TEST_EXPECT(execute_class_channel_performance_case(
+      "mpmc1Pairs", channel, ChannelRun(queue_run).set_thread_count(1)));
+    TEST_EXPECT(execute_class_channel_performance_case(
+      "mpmc2Pairs", channel, ChannelRun(queue_run).set_thread_count(2)));
+  }
+
+  // large frames copied through Mq against passed in place by SlabChannel
+  for (u32 frame_size = 1024; frame_size <= m_options.maximum_frame_size();
+       frame_size *= 4) {
+    TEST_EXPECT(
+      execute_class_frame_performance_case(FrameTransport::mq, frame_size));
+    TEST_EXPECT(
+      execute_class_frame_performance_case(FrameTransport::slab, frame_size));
+  }
+
+  return case_result();
+}
+
+template <class Channel>
+bool MqTest::execute_class_channel_performance_case(StringView name,
+                                                    Channel &channel,
+                                                    const ChannelRun &run) {
+  test::Case tc(this, name);
+
+  // thread_count producers each send count_per_thread messages and
+  // thread_count consumers each receive as many
+  struct Shared {
+    Channel *channel = nullptr;
+    ClockTimer clock;
+    u32 thread_count = 0;
+    u32 count_per_thread = 0;
+    u32 message_size = 0;
+    bool is_priority_mixed = false;
+  };
+
+  struct Worker {
+    Shared *shared = nullptr;
+    u32 index = 0;
+    u32 first_sequence = 0;
+    // consumers only
+    Histogram latency_histogram;
+    Histogram urgent_latency_histogram;
+    u64 sequence_sum = 0;
+    u32 out_of_order_count = 0;
+    bool result = false;
+  };
+
+  Shared shared;
+  shared.channel = &channel;
+  shared.thread_count = run.thread_count();
+  shared.count_per_thread = m_options.message_count() / run.thread_count();
+  shared.message_size = run.message_size();
+  shared.is_priority_mixed = run.priority_mixed() == IsPriorityMixed::yes;
+  TEST_ASSERT(shared.count_per_thread > 0);
+  TEST_ASSERT(shared.message_size >= sizeof(MessageHeader));
+
+  Vector<Worker> producers;
+  Vector<Worker> consumers;
+  producers.resize(run.thread_count());
+  consumers.resize(run.thread_count());
+
+  WorkerPool pool(run.thread_count() * 2);
+  for (u32 i = 0; i < run.thread_count(); i++) {
+    Worker &consumer = consumers.at(i);
+    consumer.shared = &shared;
+    consumer.index = i;
+    pool.add(&consumer, [](void *args) -> void * {
+      auto *consumer = reinterpret_cast<Worker *>(args);
+      Shared *shared = consumer->shared;
+
+      Vector<u8> buffer;
+      buffer.resize(shared->message_size);
+
+      // each consumer sees each producer's messages of one priority in
+      // order, even when other consumers take some of them
+      Vector<u32> next_sequence;
+      next_sequence.resize(shared->thread_count * 2);
+      for (u32 i = 0; i < next_sequence.count(); i++) {
+        next_sequence.at(i) = (i / 2) * shared->count_per_thread;
+      }
+
+      for (u32 i = 0; i < shared->count_per_thread; i++) {
+        if (shared->channel->receive(consumer->index, buffer.data(),
+                                     buffer.count()) == false) {
+          return nullptr;
+        }
+        MessageHeader header;
+        memcpy(&header, buffer.data(), sizeof(header));
+
+        const u32 latency = shared->clock.microseconds() - header.timestamp;
+        if (header.priority == urgent_priority) {
+          consumer->urgent_latency_histogram.add(latency);
+        } else {
+          consumer->latency_histogram.add(latency);
+        }
+        consumer->sequence_sum += header.sequence;
+
+        u32 &next = next_sequence.at(
+          (header.sequence / shared->count_per_thread) * 2 +
+          (header.priority == urgent_priority));
+        if (header.sequence < next) {
+          consumer->out_of_order_count++;
+        }
+        next = header.sequence + 1;
+      }
+      consumer->result = true;
+      return nullptr;
+    });
+
+    Worker &producer = producers.at(i);
+    producer.shared = &shared;
+    producer.index = i;
+    producer.first_sequence = i * shared.count_per_thread;
+    pool.add(&producer, [](void *args) -> void * {
+      auto *producer = reinterpret_cast<Worker *>(args);
+      Shared *shared = producer->shared;
+
+      Vector<u8> buffer;
+      buffer.resize(shared->message_size);
+
+      for (u32 i = 0; i < shared->count_per_thread; i++) {
+        MessageHeader header;
+        header.sequence = producer->first_sequence + i;
+        header.priority =
+          shared->is_priority_mixed && (i % urgent_interval) == 0
+            ? urgent_priority
+            : 0;
+        header.timestamp = shared->clock.microseconds();
+        memcpy(buffer.data(), &header, sizeof(header));
+        if (shared->channel->send(producer->index, buffer.data(),
+                                  buffer.count(),
+                                  header.priority) == false) {
+          return nullptr;
+        }
+      }
+      producer->result = true;
+      return nullptr;
+    });
+  }
+  TEST_ASSERT(is_success());
+
+  shared.clock.start();
+  pool.start();
+  TEST_EXPECT(pool.join());
+  shared.clock.stop();
+
+  Histogram latency_histogram;
+  Histogram urgent_latency_histogram;
+  u64 sequence_sum = 0;
+  u32 out_of_order_count = 0;
+  for (u32 i = 0; i < run.thread_count(); i++) {
+    const Worker &consumer = consumers.at(i);
+    TEST_EXPECT(producers.at(i).result);
+    TEST_EXPECT(consumer.result);
+    latency_histogram.merge(consumer.latency_histogram);
+    urgent_latency_histogram.merge(consumer.urgent_latency_histogram);
+    sequence_sum += consumer.sequence_sum;
+    out_of_order_count += consumer.out_of_order_count;
+  }
+
+  // every message arrives exactly once and in order per producer and
+  // priority
+  const u32 total_count = shared.count_per_thread * run.thread_count();
+  TEST_EXPECT(latency_histogram.count() + urgent_latency_histogram.count() ==
+              total_count);
+  TEST_EXPECT(sequence_sum == u64(total_count) * (total_count - 1) / 2);
+  TEST_EXPECT(out_of_order_count == 0);
+
+  const u32 elapsed_us = shared.clock.microseconds();
+  const u32 duration_us = elapsed_us ? elapsed_us : 1;
+  const u32 messages_per_second =
+    u32(u64(total_count) * 1000000 / duration_us);
+  const u32 bytes_per_second =
+    u32(u64(total_count) * run.message_size() * 1000000 / duration_us);
+
+  printer()
+    .key("threadPairs", NumberString(run.thread_count()))
+    .key("messages", NumberString(total_count))
+    .key("messageSize", NumberString(run.message_size()))
+    .key("duration", NumberString(duration_us, "%d us"))
+    .key("messagesPerSecond", NumberString(messages_per_second))
+    .key("bytesPerSecond", NumberString(bytes_per_second));
+  latency_histogram.print(printer(), "latency", "us");
+  if (shared.is_priority_mixed) {
+    urgent_latency_histogram.print(printer(), "urgentLatency", "us");
+  }
+
+  const GeneralString archive_prefix = "posixtest." | name;
+  ResultArchive::record(archive_prefix | ".messagesPerSecond",
+                        messages_per_second);
+  ResultArchive::record(archive_prefix | ".bytesPerSecond", bytes_per_second);
+  ResultArchive::record(archive_prefix | ".latency.p50",
+                        latency_histogram.percentile(50.0f),
+                        ResultArchive::IsHigherBetter::no);
+  ResultArchive::record(archive_prefix | ".latency.p99",
+                        latency_histogram.percentile(99.0f),
+                        ResultArchive::IsHigherBetter::no);
+  if (shared.is_priority_mixed) {
+    ResultArchive::record(archive_prefix | ".urgentLatency.p99",
+                          urgent_latency_histogram.percentile(99.0f),
+                          ResultArchive::IsHigherBetter::no);
+  }
+
+  return case_result();
+}
+
+bool MqTest::execute_class_frame_performance_case(FrameTransport transport,
+                                                  u32 frame_size) {
+  const auto case_name =
+    (transport == FrameTransport::mq ? "mqFrame" : "slabFrame") |
+    NumberString(frame_size, "%ldBytes");
+  test::Case tc(this, case_name);
+
+  // only one transport is allocated at a time
+  FrameTransfer transfer(m_options.frame_count(), frame_size);
+  if (transport == FrameTransport::mq) {
+    {
+      api::ErrorScope error_scope;
+      if (Mq("mq1").is_success()) {
+        Mq::unlink("mq1");
+      }
+    }
+    Mq mq(Mq::Attributes()
+            .set_maximum_message_count(frame_depth)
+            .set_message_size(frame_size),
+          Mq::IsExclusive::yes, "mq1");
+    Mq receive_mq("mq1");
+    TEST_ASSERT(is_success());
+    transfer.execute(&mq, &receive_mq, nullptr);
+    Mq::unlink("mq1");
+  } else {
+    SlabChannel slab_channel(frame_size, frame_depth);
+    TEST_ASSERT(is_success());
+    TEST_ASSERT(slab_channel.slab_count() == frame_depth);
+    transfer.execute(nullptr, nullptr, &slab_channel);
+  }
+
+  TEST_ASSERT(is_success());
+  TEST_EXPECT(transfer.is_complete());
+  TEST_EXPECT(transfer.error_count() == 0);
+
+  const u32 frame_count = m_options.frame_count();
+  const u32 duration_us = transfer.duration_us() ? transfer.duration_us() : 1;
+  const u32 frames_per_second = u32(u64(frame_count) * 1000000 / duration_us);
+  const u32 bytes_per_second =
+    u32(u64(frame_count) * frame_size * 1000000 / duration_us);
+
+  printer()
+    .key("frames", NumberString(frame_count))
+    .key("frameSize", NumberString(frame_size))
+    .key("depth", NumberString(frame_depth))
+    .key("duration", NumberString(duration_us, "%d us"))
+    .key("framesPerSecond", NumberString(frames_per_second))
+    .key("bytesPerSecond", NumberString(bytes_per_second));
+  transfer.latency_histogram().print(printer(), "latency", "us");
+
+  const GeneralString archive_prefix = "posixtest." | StringView(case_name);
+  ResultArchive::record(archive_prefix | ".bytesPerSecond", bytes_per_second);
+  ResultArchive::record(archive_prefix | ".latency.p99",
+                        transfer.latency_histogram().percentile(99.0f),
+                        ResultArchive::IsHigherBetter::no);
+
+  return case_result();
+}
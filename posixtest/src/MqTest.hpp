@@ -3,16 +3,53 @@
 #ifndef MQTEST_HPP
 #define MQTEST_HPP
 
+#include <sys/Cli.hpp>
 #include <test/Test.hpp>
 
 
 class MqTest : public test::Test
 {
 public:
-  MqTest();
+  class Options {
+  public:
+    Options() = default;
+    explicit Options(const sys::Cli &cli);
+
+    // messages passed through each queue by the performance case
+    API_AF(Options, u32, message_count, 10000);
+    // the Mq sweep quadruples the message size and depth up to these
+    API_AF(Options, u32, maximum_message_size, 1024);
+    API_AF(Options, u32, maximum_depth, 16);
+    // large frames passed through Mq and SlabChannel, the frame size
+    // quadruples from 1 KiB up to the maximum
+    API_AF(Options, u32, frame_count, 1000);
+    API_AF(Options, u32, maximum_frame_size, 4096);
+  };
+
+  MqTest(const Options &options = Options());
 
   bool execute_class_api_case();
+  bool execute_class_performance_case();
+
+private:
+  enum class IsPriorityMixed { no, yes };
+  enum class FrameTransport { mq, slab };
+
+  class ChannelRun {
+    // producers, the same number of consumers receive
+    API_AF(ChannelRun, u32, thread_count, 1);
+    API_AF(ChannelRun, u32, message_size, 32);
+    API_AF(ChannelRun, IsPriorityMixed, priority_mixed, IsPriorityMixed::no);
+  };
+
+  template <class Channel>
+  bool execute_class_channel_performance_case(var::StringView name,
+                                              Channel &channel,
+                                              const ChannelRun &run);
+  bool execute_class_frame_performance_case(FrameTransport transport,
+                                            u32 frame_size);
 
+  Options m_options;
 };
 
 #endif // MQTEST_HPP
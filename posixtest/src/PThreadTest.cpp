@@ -1,3 +1,5 @@
+#include <atomic>
+
 #include <chrono.hpp>
 #include <sos.hpp>
 #include <sys.hpp>
@@ -5,11 +7,67 @@
 #include <thread.hpp>
 #include <var.hpp>
 
+#include "CliOption.hpp"
+#include "FastSemaphore.hpp"
+#include "Histogram.hpp"
 #include "PThreadTest.hpp"
+#include "PolicyPriority.hpp"
+#include "ResultArchive.hpp"
+#include "WorkerPool.hpp"
 
 static pthread_mutex_t thread_mutex;
 
-PThreadTest::PThreadTest() : Test("posix::pthread") {}
+namespace {
+
+// UnnamedSemaphore constructed like FastSemaphore for the benchmark
+class KernelSemaphore : public UnnamedSemaphore {
+public:
+  explicit KernelSemaphore(u32 value)
+    : UnnamedSemaphore(UnnamedSemaphore::ProcessShared::no, value) {}
+};
+
+} // namespace
+
+PThreadTest::Options::Options(const Cli &cli) {
+  set_maximum_thread_count(parse_u32_option(
+    cli,
+    "maxThreads",
+    "largest number of threads contending for one mutex (default 4)",
+    maximum_thread_count()));
+  set_contention_duration_ms(parse_u32_option(
+    cli,
+    "contentionDuration",
+    "milliseconds each mutex configuration is contended (default 1000)",
+    contention_duration_ms()));
+  set_critical_section_length(parse_u32_option(
+    cli,
+    "criticalSection",
+    "loop iterations done while holding the mutex (default 16)",
+    critical_section_length()));
+  set_latency_sample_count(parse_u32_option(
+    cli,
+    "latencySamples",
+    "thread create/join and context switch round trips timed (default 1000)",
+    latency_sample_count()));
+  set_maximum_waiter_count(parse_u32_option(
+    cli,
+    "maxWaiters",
+    "largest number of threads waiting on one condition (default 4)",
+    maximum_waiter_count()));
+  set_condition_round_count(parse_u32_option(
+    cli,
+    "conditionRounds",
+    "wakeups timed per waiter count and wakeup kind (default 100)",
+    condition_round_count()));
+  set_semaphore_operation_count(parse_u32_option(
+    cli,
+    "semaphoreOperations",
+    "operations timed per semaphore benchmark (default 10000)",
+    semaphore_operation_count()));
+}
+
+PThreadTest::PThreadTest(const Options &options)
+  : Test("posix::pthread"), m_options(options) {}
 
 bool PThreadTest::execute_class_api_case() {
   TEST_ASSERT_RESULT(execute_class_mutex_attributes_api_case());
@@ -721,6 +779,692 @@ bool PThreadTest::execute_class_sem_api_case() {
   return case_result();
 }
 
-bool PThreadTest::execute_class_performance_case() { return true; }
+bool PThreadTest::execute_class_performance_case() {
+  TEST_ASSERT(m_options.maximum_thread_count() > 0);
+  TEST_ASSERT(m_options.contention_duration_ms() > 0);
+
+  TEST_EXPECT(execute_class_lock_timed_performance_case());
+
+  const auto middle_priority =
+    Sched::get_priority_max(Sched::Policy::round_robin) / 2;
+
+  struct Configuration {
+    const char *name;
+    Mutex::Attributes attributes;
+  };
+
+  const Configuration configuration_list[] = {
+    {"Normal", Mutex::Attributes().set_type(Mutex::Type::normal)},
+    {"Recursive", Mutex::Attributes().set_type(Mutex::Type::recursive)},
+    {"PriorityInherit",
+     Mutex::Attributes().set_protocol(Mutex::Protocol::priority_inherit)},
+    {"PriorityProtect",
+     Mutex::Attributes()
+       .set_protocol(Mutex::Protocol::priority_protect)
+       .set_priority_ceiling(middle_priority)}};
+
+  for (const Configuration &configuration : configuration_list) {
+    for (u32 thread_count = 1;
+         thread_count <= m_options.maximum_thread_count();
+         thread_count *= 2) {
+      TEST_EXPECT(execute_class_mutex_contention_performance_case(
+        configuration.name,
+        configuration.attributes,
+        thread_count));
+    }
+  }
+
+  for_each_policy_priority(
+    [this](const char *name, Sched::Policy policy, int priority) {
+      TEST_EXPECT(
+        execute_class_thread_create_performance_case(name, policy, priority));
+      TEST_EXPECT(
+        execute_class_context_switch_performance_case(name, policy, priority));
+    });
+
+  for (u32 waiter_count = 1; waiter_count <= m_options.maximum_waiter_count();
+       waiter_count *= 2) {
+    TEST_EXPECT(execute_class_condition_performance_case(waiter_count));
+  }
+
+  TEST_EXPECT(
+    execute_class_semaphore_performance_case<KernelSemaphore>("kernel"));
+  TEST_EXPECT(execute_class_semaphore_performance_case<FastSemaphore>("fast"));
+
+  return case_result();
+}
+
+template <class Semaphore>
+bool PThreadTest::execute_class_semaphore_performance_case(StringView name) {
+  const auto case_name = "semaphore" | name;
+  test::Case tc(this, case_name);
+
+  const u32 operation_count = m_options.semaphore_operation_count();
+  TEST_ASSERT(operation_count > 0);
+
+  const auto per_second = [](u32 count, u32 duration_us) {
+    return u32(u64(count) * 1000000 / (duration_us ? duration_us : 1));
+  };
+
+  const GeneralString archive_prefix = "posixtest." | StringView(case_name);
+
+  {
+    // the common case: nobody waits, the count never reaches zero
+    Semaphore semaphore(1);
+    TEST_ASSERT(is_success());
+    ClockTimer timer(ClockTimer::IsRunning::yes);
+    for (u32 i = 0; i < operation_count; i++) {
+      semaphore.wait();
+      semaphore.post();
+    }
+    timer.stop();
+    const u32 nanoseconds =
+      u32(u64(timer.microseconds()) * 1000 / operation_count);
+    printer().key("uncontendedPair", NumberString(nanoseconds, "%d ns"));
+    ResultArchive::record(
+      archive_prefix | ".uncontendedPair",
+      nanoseconds,
+      ResultArchive::IsHigherBetter::no);
+  }
+
+  struct Pair {
+    Pair(u32 first_value, u32 second_value)
+      : first(first_value), second(second_value) {}
+    Semaphore first;
+    Semaphore second;
+    u32 count = 0;
+  };
+
+  {
+    // every wait blocks: ping posts first and waits on second
+    Pair ping_pong(0, 0);
+    TEST_ASSERT(is_success());
+    ping_pong.count = operation_count;
+    ClockTimer timer(ClockTimer::IsRunning::yes);
+    auto pong_thread = Thread(
+      Thread::Attributes().set_joinable(),
+      Thread::Construct().set_argument(&ping_pong).set_function(
+        [](void *args) -> void * {
+          auto *pair = reinterpret_cast<Pair *>(args);
+          for (u32 i = 0; i < pair->count; i++) {
+            pair->first.wait();
+            pair->second.post();
+          }
+          return nullptr;
+        }));
+    TEST_ASSERT(is_success());
+    for (u32 i = 0; i < operation_count; i++) {
+      ping_pong.first.post();
+      ping_pong.second.wait();
+    }
+    TEST_EXPECT(pong_thread.join().is_success());
+    timer.stop();
+
+    const u32 round_trips_per_second =
+      per_second(operation_count, timer.microseconds());
+    printer().key(
+      "pingPongRoundTripsPerSecond",
+      NumberString(round_trips_per_second));
+    ResultArchive::record(
+      archive_prefix | ".pingPongRoundTripsPerSecond",
+      round_trips_per_second);
+  }
+
+  {
+    // bounded buffer: first counts free slots, second counts items, so
+    // waits block only when the producer gets a full buffer ahead
+    constexpr u32 slot_count = 16;
+    Pair slots_items(slot_count, 0);
+    TEST_ASSERT(is_success());
+    slots_items.count = operation_count;
+    ClockTimer timer(ClockTimer::IsRunning::yes);
+    auto producer_thread = Thread(
+      Thread::Attributes().set_joinable(),
+      Thread::Construct().set_argument(&slots_items).set_function(
+        [](void *args) -> void * {
+          auto *pair = reinterpret_cast<Pair *>(args);
+          for (u32 i = 0; i < pair->count; i++) {
+            pair->first.wait();
+            pair->second.post();
+          }
+          return nullptr;
+        }));
+    TEST_ASSERT(is_success());
+    for (u32 i = 0; i < operation_count; i++) {
+      slots_items.second.wait();
+      slots_items.first.post();
+    }
+    TEST_EXPECT(producer_thread.join().is_success());
+    timer.stop();
+
+    // every slot is back and no item is left over
+    TEST_EXPECT(slots_items.first.get_value() == s32(slot_count));
+    TEST_EXPECT(slots_items.second.get_value() == 0);
+
+    const u32 items_per_second =
+      per_second(operation_count, timer.microseconds());
+    printer().key(
+      "producerConsumerItemsPerSecond",
+      NumberString(items_per_second));
+    ResultArchive::record(
+      archive_prefix | ".producerConsumerItemsPerSecond",
+      items_per_second);
+  }
+
+  return case_result();
+}
+
+bool PThreadTest::execute_class_condition_performance_case(u32 waiter_count) {
+  const auto case_name = "condition" | NumberString(waiter_count, "%ldWaiters");
+  test::Case tc(this, case_name);
+
+  // Waiters sleep on one condition the way a worker pool does. A token is
+  // a unit of work that exactly one waiter takes, a new generation is news
+  // every waiter must see. A waiter that wakes to find neither is an empty
+  // wakeup: either spurious or the loser of a broadcast herd.
+  struct Shared {
+    Shared() : cond(mutex) {}
+    Mutex mutex;
+    Cond cond;
+    ClockTimer clock;
+    u32 waiter_count = 0;
+    u32 waiting_count = 0;
+    u32 token_count = 0;
+    u32 generation = 0;
+    u32 woken_count = 0;
+    u32 wakeup_count = 0;
+    u32 empty_wakeup_count = 0;
+    u32 notify_time = 0;
+    u32 last_wake_time = 0;
+    bool is_stop = false;
+    // time from notify to the waiter taking the token, microseconds
+    Histogram take_histogram;
+  };
+
+  struct Waiter {
+    Thread thread;
+    Shared *shared = nullptr;
+  };
+
+  Shared shared;
+  TEST_ASSERT(is_success());
+  shared.waiter_count = waiter_count;
+  shared.clock.start();
+
+  Vector<Waiter> waiters;
+  waiters.resize(waiter_count);
+  for (auto &waiter : waiters) {
+    waiter.shared = &shared;
+    waiter.thread = Thread(
+      Thread::Attributes().set_stack_size(8192).set_joinable(),
+      Thread::Construct().set_argument(&waiter).set_function(
+        [](void *args) -> void * {
+          auto *waiter = reinterpret_cast<Waiter *>(args);
+          Shared *shared = waiter->shared;
+          Mutex::Scope ms(shared->mutex);
+          u32 seen_generation = shared->generation;
+          while (shared->is_stop == false) {
+            if (shared->token_count) {
+              shared->token_count--;
+              shared->take_histogram.add(shared->clock.microseconds() -
+                                         shared->notify_time);
+            } else if (shared->generation != seen_generation) {
+              seen_generation = shared->generation;
+              if (++shared->woken_count == shared->waiter_count) {
+                shared->last_wake_time = shared->clock.microseconds();
+              }
+            } else {
+              shared->waiting_count++;
+              shared->cond.wait();
+              shared->waiting_count--;
+              shared->wakeup_count++;
+              if (shared->token_count == 0 &&
+                  shared->generation == seen_generation &&
+                  shared->is_stop == false) {
+                shared->empty_wakeup_count++;
+              }
+            }
+          }
+          return nullptr;
+        }));
+  }
+  TEST_ASSERT(is_success());
+
+  // returns once every waiter sleeps on the condition, is_done() checked
+  // with the mutex held
+  const auto wait_until_idle = [&](bool (*is_done)(const Shared &)) {
+    while (true) {
+      {
+        Mutex::Scope ms(shared.mutex);
+        if (is_done(shared) && shared.waiting_count == shared.waiter_count) {
+          return;
+        }
+      }
+      Sched().yield();
+    }
+  };
+
+  const auto is_token_taken = [](const Shared &shared) {
+    return shared.token_count == 0;
+  };
+
+  const auto is_herd_done = [](const Shared &shared) {
+    return shared.woken_count == shared.waiter_count;
+  };
+
+  enum class Wakeup { signal, broadcast, herd };
+  for (const Wakeup wakeup :
+       {Wakeup::signal, Wakeup::broadcast, Wakeup::herd}) {
+    Histogram herd_histogram;
+    wait_until_idle(is_token_taken);
+    {
+      Mutex::Scope ms(shared.mutex);
+      shared.take_histogram.reset();
+      shared.wakeup_count = 0;
+      shared.empty_wakeup_count = 0;
+    }
+
+    for (u32 i = 0; i < m_options.condition_round_count(); i++) {
+      {
+        Mutex::Scope ms(shared.mutex);
+        shared.notify_time = shared.clock.microseconds();
+        if (wakeup == Wakeup::herd) {
+          shared.woken_count = 0;
+          shared.generation++;
+          shared.cond.broadcast();
+        } else {
+          // one unit of work, signal wakes one waiter and broadcast wakes
+          // them all to compete for it
+          shared.token_count = 1;
+          if (wakeup == Wakeup::signal) {
+            shared.cond.signal();
+          } else {
+            shared.cond.broadcast();
+          }
+        }
+      }
+
+      if (wakeup == Wakeup::herd) {
+        wait_until_idle(is_herd_done);
+        herd_histogram.add(shared.last_wake_time - shared.notify_time);
+      } else {
+        wait_until_idle(is_token_taken);
+      }
+    }
+
+    const StringView wakeup_name = wakeup == Wakeup::signal      ? "signal"
+                                   : wakeup == Wakeup::broadcast ? "broadcast"
+                                                                 : "herd";
+    Mutex::Scope ms(shared.mutex);
+    const GeneralString archive_prefix =
+      "posixtest." | StringView(case_name) | "." | wakeup_name;
+
+    printer::Printer::Object wakeup_object(printer(), wakeup_name);
+    printer()
+      .key("wakeups", NumberString(shared.wakeup_count))
+      .key("emptyWakeups", NumberString(shared.empty_wakeup_count));
+    if (wakeup == Wakeup::herd) {
+      // until the last of the waiters runs
+      herd_histogram.print(printer(), "allAwake", "us");
+      ResultArchive::record(
+        archive_prefix | ".allAwake.p99",
+        herd_histogram.percentile(99.0f),
+        ResultArchive::IsHigherBetter::no);
+    } else {
+      TEST_EXPECT(shared.take_histogram.count() ==
+                  m_options.condition_round_count());
+      shared.take_histogram.print(printer(), "wakeup", "us");
+      ResultArchive::record(
+        archive_prefix | ".wakeup.p99",
+        shared.take_histogram.percentile(99.0f),
+        ResultArchive::IsHigherBetter::no);
+    }
+    ResultArchive::record(
+      archive_prefix | ".emptyWakeups",
+      shared.empty_wakeup_count,
+      ResultArchive::IsHigherBetter::no);
+  }
+
+  {
+    Mutex::Scope ms(shared.mutex);
+    shared.is_stop = true;
+    shared.cond.broadcast();
+  }
+  for (auto &waiter : waiters) {
+    TEST_EXPECT(waiter.thread.join().is_success());
+  }
+
+  return case_result();
+}
+
+bool PThreadTest::execute_class_lock_timed_performance_case() {
+  test::Case tc(this, "lockTimed");
+
+  // the mutex case checks that lock_timed() gives up, this times how late
+  constexpr u32 timeout_us = 100000;
+  Mutex mutex;
+  ClockTimer timer(ClockTimer::IsRunning::yes);
+  {
+    Mutex::Scope ms(mutex);
+    Thread(
+      Thread::Attributes().set_joinable(),
+      Thread::Construct().set_argument(&mutex).set_function(
+        [](void *args) -> void * {
+          auto *mutex = reinterpret_cast<Mutex *>(args);
+          mutex->lock_timed(ClockTime(100_milliseconds));
+          return nullptr;
+        }))
+      .join();
+  }
+  timer.stop();
+  TEST_ASSERT(is_success());
+  TEST_EXPECT(timer.microseconds() >= timeout_us);
+
+  const u32 overshoot_us =
+    timer.microseconds() > timeout_us ? timer.microseconds() - timeout_us : 0;
+  printer()
+    .key("timeout", NumberString(timeout_us, "%d us"))
+    .key("duration", NumberString(timer.microseconds(), "%d us"))
+    .key("overshoot", NumberString(overshoot_us, "%d us"));
+
+  ResultArchive::record(
+    "posixtest.lockTimed.overshoot",
+    overshoot_us,
+    ResultArchive::IsHigherBetter::no);
+
+  return case_result();
+}
+
+bool PThreadTest::execute_class_thread_create_performance_case(
+  StringView policy_name,
+  Sched::Policy policy,
+  int priority) {
+  const auto case_name =
+    "threadCreate" | policy_name | NumberString(priority);
+  test::Case tc(this, case_name);
+
+  // create through join, the thread returns at once
+  Histogram histogram;
+  for (u32 i = 0; i < m_options.latency_sample_count(); i++) {
+    ClockTimer timer(ClockTimer::IsRunning::yes);
+    Thread(
+      Thread::Attributes()
+        .set_joinable()
+        .set_sched_policy(policy)
+        .set_sched_priority(priority),
+      Thread::Construct().set_argument(nullptr).set_function(
+        [](void *) -> void * { return nullptr; }))
+      .join();
+    timer.stop();
+    TEST_ASSERT(is_success());
+    histogram.add(timer.microseconds());
+  }
+
+  histogram.print(printer(), "createJoin", "us");
+
+  const GeneralString archive_prefix = "posixtest." | StringView(case_name);
+  ResultArchive::record(
+    archive_prefix | ".mean",
+    histogram.mean(),
+    ResultArchive::IsHigherBetter::no);
+  ResultArchive::record(
+    archive_prefix | ".p99",
+    histogram.percentile(99.0f),
+    ResultArchive::IsHigherBetter::no);
+
+  return case_result();
+}
+
+bool PThreadTest::execute_class_context_switch_performance_case(
+  StringView policy_name,
+  Sched::Policy policy,
+  int priority) {
+  const auto case_name =
+    "contextSwitch" | policy_name | NumberString(priority);
+  test::Case tc(this, case_name);
+
+  enum class Handoff { semaphore, condition };
+
+  // ping hands off to pong and blocks until pong hands back, so each
+  // round trip is two context switches
+  struct PingPong {
+    PingPong()
+      : ping_semaphore(UnnamedSemaphore::ProcessShared::no, 0),
+        pong_semaphore(UnnamedSemaphore::ProcessShared::no, 0), cond(mutex) {}
+    UnnamedSemaphore ping_semaphore;
+    UnnamedSemaphore pong_semaphore;
+    Mutex mutex;
+    Cond cond;
+    bool is_ping_turn = true;
+    Handoff handoff = Handoff::semaphore;
+    u32 count = 0;
+    // ping's view of each round trip, microseconds
+    Histogram histogram;
+  };
+
+  const auto ping = [](void *args) -> void * {
+    auto *ping_pong = reinterpret_cast<PingPong *>(args);
+    if (ping_pong->handoff == Handoff::semaphore) {
+      for (u32 i = 0; i < ping_pong->count; i++) {
+        ClockTimer timer(ClockTimer::IsRunning::yes);
+        ping_pong->pong_semaphore.post();
+        ping_pong->ping_semaphore.wait();
+        timer.stop();
+        ping_pong->histogram.add(timer.microseconds());
+      }
+      return nullptr;
+    }
+
+    Mutex::Scope ms(ping_pong->mutex);
+    for (u32 i = 0; i < ping_pong->count; i++) {
+      ClockTimer timer(ClockTimer::IsRunning::yes);
+      ping_pong->is_ping_turn = false;
+      ping_pong->cond.signal();
+      while (ping_pong->is_ping_turn == false) {
+        ping_pong->cond.wait();
+      }
+      timer.stop();
+      ping_pong->histogram.add(timer.microseconds());
+    }
+    return nullptr;
+  };
+
+  const auto pong = [](void *args) -> void * {
+    auto *ping_pong = reinterpret_cast<PingPong *>(args);
+    if (ping_pong->handoff == Handoff::semaphore) {
+      for (u32 i = 0; i < ping_pong->count; i++) {
+        ping_pong->pong_semaphore.wait();
+        ping_pong->ping_semaphore.post();
+      }
+      return nullptr;
+    }
+
+    Mutex::Scope ms(ping_pong->mutex);
+    for (u32 i = 0; i < ping_pong->count; i++) {
+      while (ping_pong->is_ping_turn) {
+        ping_pong->cond.wait();
+      }
+      ping_pong->is_ping_turn = true;
+      ping_pong->cond.signal();
+    }
+    return nullptr;
+  };
+
+  const auto attributes = Thread::Attributes()
+                            .set_joinable()
+                            .set_sched_policy(policy)
+                            .set_sched_priority(priority);
+
+  const GeneralString archive_prefix = "posixtest." | StringView(case_name);
+  for (const Handoff handoff : {Handoff::semaphore, Handoff::condition}) {
+    const StringView handoff_name =
+      handoff == Handoff::semaphore ? "semaphore" : "condition";
+
+    PingPong ping_pong;
+    TEST_ASSERT(is_success());
+    ping_pong.handoff = handoff;
+    ping_pong.count = m_options.latency_sample_count();
+
+    // pong first so it is waiting when ping starts
+    auto pong_thread = Thread(
+      attributes,
+      Thread::Construct().set_argument(&ping_pong).set_function(pong));
+    auto ping_thread = Thread(
+      attributes,
+      Thread::Construct().set_argument(&ping_pong).set_function(ping));
+    TEST_ASSERT(is_success());
+    TEST_EXPECT(ping_thread.join().is_success());
+    TEST_EXPECT(pong_thread.join().is_success());
+
+    TEST_EXPECT(ping_pong.histogram.count() == ping_pong.count);
+    ping_pong.histogram.print(printer(), handoff_name | "RoundTrip", "us");
+
+    ResultArchive::record(
+      archive_prefix | "." | handoff_name | ".mean",
+      ping_pong.histogram.mean(),
+      ResultArchive::IsHigherBetter::no);
+    ResultArchive::record(
+      archive_prefix | "." | handoff_name | ".p99",
+      ping_pong.histogram.percentile(99.0f),
+      ResultArchive::IsHigherBetter::no);
+  }
+
+  return case_result();
+}
+
+bool PThreadTest::execute_class_mutex_contention_performance_case(
+  StringView name,
+  const Mutex::Attributes &attributes,
+  u32 thread_count) {
+  const auto case_name =
+    "mutex" | name | NumberString(thread_count, "%ldThreads");
+  test::Case tc(this, case_name);
+
+  // everything the workers touch while holding the mutex
+  struct Shared {
+    explicit Shared(const Mutex::Attributes &attributes) : mutex(attributes) {}
+    Mutex mutex;
+    u32 critical_section_length = 0;
+    u32 count = 0;
+    volatile u32 work = 0;
+    std::atomic<bool> is_stop{false};
+  };
+
+  struct Worker {
+    Shared *shared = nullptr;
+    // time spent in lock(), nanoseconds (an uncontended lock is well below
+    // a microsecond)
+    Histogram wait_histogram;
+    u32 count = 0;
+    bool result = false;
+  };
+
+  Shared shared(attributes);
+  TEST_ASSERT(is_success());
+  shared.critical_section_length = m_options.critical_section_length();
+
+  Vector<Worker> workers;
+  workers.resize(thread_count);
+
+  WorkerPool pool(thread_count);
+  for (auto &worker : workers) {
+    worker.shared = &shared;
+    pool.add(&worker, [](void *args) -> void * {
+      auto *worker = reinterpret_cast<Worker *>(args);
+      Shared *shared = worker->shared;
+
+      while (shared->is_stop == false) {
+        const ClockTime wait_start = ClockTime::get_system_time();
+        if (shared->mutex.lock().is_error()) {
+          return nullptr;
+        }
+        const ClockTime wait_time = ClockTime::get_system_time() - wait_start;
+        for (u32 i = 0; i < shared->critical_section_length; i++) {
+          shared->work = shared->work + i;
+        }
+        shared->count++;
+        shared->mutex.unlock();
+
+        // waits of 4 s or more are clamped to the histogram range
+        worker->wait_histogram.add(
+          wait_time.seconds() < 4
+            ? u32(wait_time.seconds()) * 1000000000UL
+                + u32(wait_time.nanoseconds())
+            : 0xffffffff);
+        worker->count++;
+      }
+      worker->result = true;
+      return nullptr;
+    });
+  }
+  TEST_ASSERT(is_success());
+
+  ClockTimer wall_timer(ClockTimer::IsRunning::yes);
+  pool.start();
+  while (wall_timer.milliseconds() < m_options.contention_duration_ms()) {
+    wait(10_milliseconds);
+  }
+  shared.is_stop = true;
+  TEST_EXPECT(pool.join());
+  wall_timer.stop();
+
+  Histogram wait_histogram;
+  u64 total_count = 0;
+  u64 square_sum = 0;
+  u32 minimum_count = 0;
+  u32 maximum_count = 0;
+  for (u32 i = 0; i < thread_count; i++) {
+    const Worker &worker = workers.at(i);
+    TEST_EXPECT(worker.result);
+    printer().key(NumberString(i, "thread%ld"), NumberString(worker.count));
+    wait_histogram.merge(worker.wait_histogram);
+    total_count += worker.count;
+    square_sum += u64(worker.count) * worker.count;
+    if (i == 0 || worker.count < minimum_count) {
+      minimum_count = worker.count;
+    }
+    if (worker.count > maximum_count) {
+      maximum_count = worker.count;
+    }
+  }
+
+  // a lost update means the mutex did not exclude
+  TEST_EXPECT(shared.count == total_count);
+
+  const u32 elapsed_us = wall_timer.microseconds();
+  const u32 duration_us = elapsed_us ? elapsed_us : 1;
+  const u32 locks_per_second = u32(total_count * 1000000 / duration_us);
+
+  // Jain's index: 100% when every thread got the same number of locks,
+  // 100% / threads when one thread got all of them
+  const u32 fairness =
+    square_sum
+      ? u32(total_count * total_count * 100 / (thread_count * square_sum))
+      : 0;
+
+  printer()
+    .key("threads", NumberString(thread_count))
+    .key("duration", NumberString(duration_us, "%d us"))
+    .key("locks", NumberString(u32(total_count)))
+    .key("locksPerSecond", NumberString(locks_per_second))
+    .key("minThreadLocks", NumberString(minimum_count))
+    .key("maxThreadLocks", NumberString(maximum_count))
+    .key("fairness", NumberString(fairness, "%d%%"));
+  wait_histogram.print(printer(), "lockWait", "ns");
+
+  const GeneralString archive_prefix = "posixtest." | StringView(case_name);
+  ResultArchive::record(archive_prefix | ".locksPerSecond", locks_per_second);
+  ResultArchive::record(
+    archive_prefix | ".lockWaitNs.mean",
+    wait_histogram.mean(),
+    ResultArchive::IsHigherBetter::no);
+  ResultArchive::record(
+    archive_prefix | ".lockWaitNs.p99",
+    wait_histogram.percentile(99.0f),
+    ResultArchive::IsHigherBetter::no);
+  ResultArchive::record(archive_prefix | ".fairness", fairness);
+
+  return case_result();
+}
 
 bool PThreadTest::execute_class_stress_case() { return true; }
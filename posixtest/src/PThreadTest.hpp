@@ -3,12 +3,36 @@
 #ifndef PTHREADTEST_HPP
 #define PTHREADTEST_HPP
 
+#include <sys/Cli.hpp>
 #include <test/Test.hpp>
 #include <thread/Mutex.hpp>
+#include <thread/Sched.hpp>
 
 class PThreadTest : public test::Test {
 public:
-    PThreadTest();
+    class Options {
+    public:
+      Options() = default;
+      explicit Options(const sys::Cli &cli);
+
+      // the contention benchmark doubles the threads up to the maximum
+      API_AF(Options, u32, maximum_thread_count, 4);
+      // how long each mutex configuration is contended
+      API_AF(Options, u32, contention_duration_ms, 1000);
+      // loop iterations done while holding the mutex
+      API_AF(Options, u32, critical_section_length, 16);
+      // create/join and ping-pong round trips timed per configuration
+      API_AF(Options, u32, latency_sample_count, 1000);
+      // the condition benchmark doubles the waiters up to the maximum, each
+      // waiter has an 8 KiB stack so 4 fit in the 64 KiB application
+      API_AF(Options, u32, maximum_waiter_count, 4);
+      // wakeups timed for each waiter count and wakeup kind
+      API_AF(Options, u32, condition_round_count, 100);
+      // post/wait pairs, round trips and items per semaphore benchmark
+      API_AF(Options, u32, semaphore_operation_count, 10000);
+    };
+
+    PThreadTest(const Options &options = Options());
 
     bool execute_class_api_case();
     bool execute_class_performance_case();
@@ -26,6 +50,25 @@ private:
   bool execute_class_sem_api_case();
 
   bool try_lock_in_thread(thread::Mutex * mutex);
+
+  bool execute_class_mutex_contention_performance_case(
+    var::StringView name,
+    const thread::Mutex::Attributes &attributes,
+    u32 thread_count);
+  bool execute_class_lock_timed_performance_case();
+  bool execute_class_thread_create_performance_case(
+    var::StringView policy_name,
+    thread::Sched::Policy policy,
+    int priority);
+  bool execute_class_context_switch_performance_case(
+    var::StringView policy_name,
+    thread::Sched::Policy policy,
+    int priority);
+  bool execute_class_condition_performance_case(u32 waiter_count);
+  template <class Semaphore>
+  bool execute_class_semaphore_performance_case(var::StringView name);
+
+  Options m_options;
 };
 
 #endif // PTHREADTEST_HPP
@@ -0,0 +1,41 @@
+// Copyright 2011-2021 Tyler Gilbert and Stratify Labs, Inc; see LICENSE.md
+
+#ifndef POLICYPRIORITY_HPP
+#define POLICYPRIORITY_HPP
+
+#include <thread/Sched.hpp>
+
+// Calls function(name, policy, priority) for the lowest, middle and highest
+// priority of each scheduling policy, the configurations the performance
+// cases are timed at.
+template <typename Function> void for_each_policy_priority(Function function) {
+  struct Policy {
+    const char *name;
+    thread::Sched::Policy policy;
+  };
+
+  const Policy policy_list[] = {
+    {"Other", thread::Sched::Policy::other},
+    {"RoundRobin", thread::Sched::Policy::round_robin},
+    {"Fifo", thread::Sched::Policy::fifo}};
+
+  for (const Policy &policy : policy_list) {
+    const int min_priority = thread::Sched::get_priority_min(policy.policy);
+    const int max_priority = thread::Sched::get_priority_max(policy.policy);
+    const int priority_list[] = {
+      min_priority,
+      (min_priority + max_priority) / 2,
+      max_priority};
+
+    for (u32 i = 0; i < sizeof(priority_list) / sizeof(int); i++) {
+      const int priority = priority_list[i];
+      // policies with a narrow range repeat priorities
+      if (i > 0 && priority == priority_list[i - 1]) {
+        continue;
+      }
+      function(policy.name, policy.policy, priority);
+    }
+  }
+}
+
+#endif // POLICYPRIORITY_HPP
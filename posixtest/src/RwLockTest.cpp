@@ -0,0 +1,281 @@
+// Copyright 2011-2021 Tyler Gilbert and Stratify Labs, Inc; see LICENSE.md
+
+#include <atomic>
+#include <pthread.h>
+
+#include <chrono.hpp>
+#include <test/Case.hpp>
+#include <thread.hpp>
+#include <var.hpp>
+
+#include "CliOption.hpp"
+#include "Histogram.hpp"
+#include "PseudoRandom.hpp"
+#include "ResultArchive.hpp"
+#include "RwLockTest.hpp"
+#include "SeqLock.hpp"
+#include "WorkerPool.hpp"
+
+namespace {
+
+// stands in for a configuration store, every word holds the version so a
+// torn read shows up as words that disagree
+struct Config {
+  u32 words[8];
+};
+
+Config make_config(u32 version) {
+  Config config;
+  for (u32 &word : config.words) {
+    word = version;
+  }
+  return config;
+}
+
+bool is_consistent(const Config &config) {
+  for (const u32 word : config.words) {
+    if (word != config.words[0]) {
+      return false;
+    }
+  }
+  return true;
+}
+
+} // namespace
+
+RwLockTest::Options::Options(const Cli &cli) {
+  set_maximum_thread_count(parse_u32_option(
+    cli,
+    "rwlockMaxThreads",
+    "largest number of threads sharing the lock (default 4)",
+    maximum_thread_count()));
+  set_duration_ms(parse_u32_option(
+    cli,
+    "rwlockDuration",
+    "milliseconds per lock, read ratio and thread count (default 500)",
+    duration_ms()));
+}
+
+RwLockTest::RwLockTest(const Options &options)
+  : test::Test("posix::rwlock"), m_options(options) {}
+
+bool RwLockTest::execute_class_api_case() {
+  TEST_ASSERT_RESULT(execute_class_rwlock_api_case());
+  TEST_ASSERT_RESULT(execute_class_seqlock_api_case());
+  return case_result();
+}
+
+bool RwLockTest::execute_class_rwlock_api_case() {
+  test::Case tc(this, "rwlock");
+
+  pthread_rwlock_t rwlock;
+  TEST_ASSERT(pthread_rwlock_init(&rwlock, nullptr) == 0);
+
+  // readers share the lock, a writer is kept out
+  TEST_EXPECT(pthread_rwlock_rdlock(&rwlock) == 0);
+  TEST_EXPECT(pthread_rwlock_tryrdlock(&rwlock) == 0);
+  TEST_EXPECT(pthread_rwlock_trywrlock(&rwlock) == EBUSY);
+  TEST_EXPECT(pthread_rwlock_unlock(&rwlock) == 0);
+  TEST_EXPECT(pthread_rwlock_unlock(&rwlock) == 0);
+
+  // a writer keeps out readers in other threads
+  TEST_EXPECT(pthread_rwlock_wrlock(&rwlock) == 0);
+  int try_result = 0;
+  {
+    struct Arguments {
+      pthread_rwlock_t *rwlock;
+      int result;
+    };
+    Arguments arguments = {&rwlock, 0};
+    Thread(Thread::Attributes().set_joinable(),
+           Thread::Construct().set_argument(&arguments).set_function(
+             [](void *args) -> void * {
+               auto *arguments = reinterpret_cast<Arguments *>(args);
+               arguments->result = pthread_rwlock_tryrdlock(arguments->rwlock);
+               if (arguments->result == 0) {
+                 pthread_rwlock_unlock(arguments->rwlock);
+               }
+               return nullptr;
+             }))
+      .join();
+    try_result = arguments.result;
+  }
+  TEST_EXPECT(try_result == EBUSY);
+  TEST_EXPECT(pthread_rwlock_unlock(&rwlock) == 0);
+
+  TEST_EXPECT(pthread_rwlock_trywrlock(&rwlock) == 0);
+  TEST_EXPECT(pthread_rwlock_unlock(&rwlock) == 0);
+  TEST_EXPECT(pthread_rwlock_destroy(&rwlock) == 0);
+
+  return case_result();
+}
+
+bool RwLockTest::execute_class_seqlock_api_case() {
+  test::Case tc(this, "seqlock");
+
+  SeqLock<Config> seqlock(make_config(1));
+  TEST_EXPECT(seqlock.version() == 0);
+  TEST_EXPECT(seqlock.load().words[0] == 1);
+
+  seqlock.store(make_config(2));
+  TEST_EXPECT(seqlock.version() == 1);
+  const Config config = seqlock.load();
+  TEST_EXPECT(is_consistent(config) && config.words[0] == 2);
+
+  return case_result();
+}
+
+bool RwLockTest::execute_class_performance_case() {
+  TEST_ASSERT(m_options.maximum_thread_count() > 0);
+  TEST_ASSERT(m_options.duration_ms() > 0);
+
+  for (const Lock lock : {Lock::rwlock, Lock::seqlock}) {
+    for (const u32 read_percent : {99, 90, 50}) {
+      for (u32 thread_count = 1;
+           thread_count <= m_options.maximum_thread_count();
+           thread_count *= 2) {
+        TEST_EXPECT(execute_class_lock_performance_case(
+          lock,
+          read_percent,
+          thread_count));
+      }
+    }
+  }
+
+  return case_result();
+}
+
+bool RwLockTest::execute_class_lock_performance_case(Lock lock,
+                                                     u32 read_percent,
+                                                     u32 thread_count) {
+  const auto case_name = (lock == Lock::rwlock ? "rwlock" : "seqlock") |
+                         NumberString(read_percent, "%ldRead") |
+                         NumberString(thread_count, "%ldThreads");
+  test::Case tc(this, case_name);
+
+  // every thread reads or writes the same config, picking the operation
+  // at random so reads and writes interleave at the requested ratio
+  struct Shared {
+    Lock lock = Lock::rwlock;
+    pthread_rwlock_t rwlock;
+    Config config;
+    SeqLock<Config> seqlock;
+    u32 read_percent = 0;
+    u32 version = 0;
+    std::atomic<bool> is_stop{false};
+  };
+
+  struct Worker {
+    Shared *shared = nullptr;
+    u32 seed = 1;
+    u32 read_count = 0;
+    u32 write_count = 0;
+    u32 torn_count = 0;
+    // time from asking for the write lock to holding it, microseconds
+    Histogram writer_wait_histogram;
+  };
+
+  Shared shared;
+  shared.lock = lock;
+  shared.read_percent = read_percent;
+  shared.config = make_config(0);
+  TEST_ASSERT(pthread_rwlock_init(&shared.rwlock, nullptr) == 0);
+
+  Vector<Worker> workers;
+  workers.resize(thread_count);
+
+  WorkerPool pool(thread_count);
+  for (u32 i = 0; i < thread_count; i++) {
+    Worker &worker = workers.at(i);
+    worker.shared = &shared;
+    worker.seed = i + 1;
+    pool.add(&worker, [](void *args) -> void * {
+      auto *worker = reinterpret_cast<Worker *>(args);
+      Shared *shared = worker->shared;
+      PseudoRandom random(worker->seed);
+
+      while (shared->is_stop == false) {
+        const bool is_read = random.next(100) < shared->read_percent;
+        Config config;
+        if (is_read) {
+          if (shared->lock == Lock::rwlock) {
+            pthread_rwlock_rdlock(&shared->rwlock);
+            config = shared->config;
+            pthread_rwlock_unlock(&shared->rwlock);
+          } else {
+            config = shared->seqlock.load();
+          }
+          if (is_consistent(config) == false) {
+            worker->torn_count++;
+          }
+          worker->read_count++;
+          continue;
+        }
+
+        ClockTimer wait_timer(ClockTimer::IsRunning::yes);
+        if (shared->lock == Lock::rwlock) {
+          pthread_rwlock_wrlock(&shared->rwlock);
+          wait_timer.stop();
+          shared->config = make_config(++shared->version);
+          pthread_rwlock_unlock(&shared->rwlock);
+        } else {
+          // the seqlock writer waits only for other writers, inside
+          // store(), so the wait includes the (short) copy
+          shared->seqlock.store(make_config(worker->seed));
+          wait_timer.stop();
+        }
+        worker->writer_wait_histogram.add(wait_timer.microseconds());
+        worker->write_count++;
+      }
+      return nullptr;
+    });
+  }
+  TEST_ASSERT(is_success());
+
+  ClockTimer wall_timer(ClockTimer::IsRunning::yes);
+  pool.start();
+  while (wall_timer.milliseconds() < m_options.duration_ms()) {
+    wait(10_milliseconds);
+  }
+  shared.is_stop = true;
+  TEST_EXPECT(pool.join());
+  wall_timer.stop();
+  TEST_EXPECT(pthread_rwlock_destroy(&shared.rwlock) == 0);
+
+  Histogram writer_wait_histogram;
+  u32 read_count = 0;
+  u32 write_count = 0;
+  u32 torn_count = 0;
+  for (const auto &worker : workers) {
+    writer_wait_histogram.merge(worker.writer_wait_histogram);
+    read_count += worker.read_count;
+    write_count += worker.write_count;
+    torn_count += worker.torn_count;
+  }
+
+  // a reader never sees a half written config
+  TEST_EXPECT(torn_count == 0);
+
+  const u32 elapsed_us = wall_timer.microseconds();
+  const u32 duration_us = elapsed_us ? elapsed_us : 1;
+  const u32 operations_per_second =
+    u32(u64(read_count + write_count) * 1000000 / duration_us);
+
+  printer()
+    .key("reads", NumberString(read_count))
+    .key("writes", NumberString(write_count))
+    .key("tornReads", NumberString(torn_count))
+    .key("duration", NumberString(duration_us, "%d us"))
+    .key("operationsPerSecond", NumberString(operations_per_second));
+  // the maximum is the longest a writer was starved
+  writer_wait_histogram.print(printer(), "writerWait", "us");
+
+  const GeneralString archive_prefix = "posixtest." | StringView(case_name);
+  ResultArchive::record(archive_prefix | ".operationsPerSecond",
+                        operations_per_second);
+  ResultArchive::record(archive_prefix | ".writerWait.max",
+                        writer_wait_histogram.maximum(),
+                        ResultArchive::IsHigherBetter::no);
+
+  return case_result();
+}
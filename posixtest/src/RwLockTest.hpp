@@ -0,0 +1,38 @@
+// Copyright 2011-2021 Tyler Gilbert and Stratify Labs, Inc; see LICENSE.md
+
+#ifndef RWLOCKTEST_HPP
+#define RWLOCKTEST_HPP
+
+#include <sys/Cli.hpp>
+#include <test/Test.hpp>
+
+class RwLockTest : public test::Test {
+public:
+  class Options {
+  public:
+    Options() = default;
+    explicit Options(const sys::Cli &cli);
+
+    // the benchmark doubles the threads up to the maximum
+    API_AF(Options, u32, maximum_thread_count, 4);
+    // how long each lock, ratio and thread count runs
+    API_AF(Options, u32, duration_ms, 500);
+  };
+
+  RwLockTest(const Options &options = Options());
+
+  bool execute_class_api_case();
+  bool execute_class_performance_case();
+
+private:
+  enum class Lock { rwlock, seqlock };
+
+  bool execute_class_rwlock_api_case();
+  bool execute_class_seqlock_api_case();
+  bool execute_class_lock_performance_case(Lock lock, u32 read_percent,
+                                           u32 thread_count);
+
+  Options m_options;
+};
+
+#endif // RWLOCKTEST_HPP
@@ -0,0 +1,86 @@
+// Copyright 2011-2021 Tyler Gilbert and Stratify Labs, Inc; see LICENSE.md
+
+#ifndef SEQLOCK_HPP
+#define SEQLOCK_HPP
+
+#include <atomic>
+#include <cstring>
+#include <type_traits>
+
+#include <thread/Mutex.hpp>
+#include <thread/Sched.hpp>
+
+// Sequence lock for small, read-mostly values such as configuration.
+//
+// Readers never write shared memory: load() copies the value and retries if
+// the sequence number changed (or was odd, a store in progress) while it
+// copied. Stores are serialized by a mutex and bump the sequence before and
+// after writing. Readers never block a writer, so a writer waits only for
+// other writers.
+//
+// The value is kept as atomic words copied with relaxed loads and stores, a
+// reader racing a store gets a torn copy it throws away rather than a data
+// race.
+//
+// A reader that catches a store in progress yields and retries. On a single
+// core the store finishes only when the writer runs again, so writers must
+// not run at a lower priority than the readers.
+template <typename T> class SeqLock {
+  static_assert(std::is_trivially_copyable<T>::value,
+                "SeqLock copies the value with memcpy");
+
+public:
+  SeqLock() { store_words(T()); }
+  explicit SeqLock(const T &value) { store_words(value); }
+
+  T load() const {
+    u32 words[word_count];
+    while (true) {
+      const u32 before = m_sequence.load(std::memory_order_acquire);
+      if ((before & 1) == 0) {
+        for (u32 i = 0; i < word_count; i++) {
+          words[i] = m_words[i].load(std::memory_order_relaxed);
+        }
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (m_sequence.load(std::memory_order_relaxed) == before) {
+          T value;
+          memcpy(&value, words, sizeof(T));
+          return value;
+        }
+      }
+      thread::Sched().yield();
+    }
+  }
+
+  SeqLock &store(const T &value) {
+    thread::Mutex::Scope write_scope(m_write_mutex);
+    const u32 sequence = m_sequence.load(std::memory_order_relaxed);
+    m_sequence.store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    store_words(value);
+    m_sequence.store(sequence + 2, std::memory_order_release);
+    return *this;
+  }
+
+  // number of completed stores
+  u32 version() const {
+    return m_sequence.load(std::memory_order_acquire) / 2;
+  }
+
+private:
+  static constexpr u32 word_count = (sizeof(T) + sizeof(u32) - 1) / sizeof(u32);
+
+  std::atomic<u32> m_sequence{0};
+  std::atomic<u32> m_words[word_count];
+  thread::Mutex m_write_mutex;
+
+  void store_words(const T &value) {
+    u32 words[word_count] = {};
+    memcpy(words, &value, sizeof(T));
+    for (u32 i = 0; i < word_count; i++) {
+      m_words[i].store(words[i], std::memory_order_relaxed);
+    }
+  }
+};
+
+#endif // SEQLOCK_HPP
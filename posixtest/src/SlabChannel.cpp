@@ -0,0 +1,52 @@
+// Copyright 2011-2021 Tyler Gilbert and Stratify Labs, Inc; see LICENSE.md
+
+#include <thread.hpp>
+#include <var.hpp>
+
+#include "SlabChannel.hpp"
+
+SlabChannel::SlabChannel(u32 slab_size, u32 slab_count)
+  : m_slab_size(slab_size),
+    m_slab_count(slab_count < maximum_slab_count ? slab_count
+                                                 : maximum_slab_count),
+    m_free_semaphore(UnnamedSemaphore::ProcessShared::no, m_slab_count),
+    m_sent_semaphore(UnnamedSemaphore::ProcessShared::no, 0) {
+  m_memory.resize(m_slab_size * m_slab_count);
+  for (u32 i = 0; i < m_slab_count; i++) {
+    m_free_queue.push(i);
+  }
+}
+
+SlabChannel::Slab SlabChannel::acquire() {
+  // the semaphore counts the handles that have been pushed, with more than
+  // one thread releasing the next cell may be claimed but not yet published
+  // so pop() can still fail for a moment
+  m_free_semaphore.wait();
+  Slab slab = {0, 0};
+  while (m_free_queue.pop(slab.index) == false) {
+    thread::Sched().yield();
+  }
+  return slab;
+}
+
+SlabChannel &SlabChannel::send(const Slab &slab) {
+  m_sent_queue.push(slab);
+  m_sent_semaphore.post();
+  return *this;
+}
+
+SlabChannel::Slab SlabChannel::receive() {
+  // same as acquire(), with more than one sender
+  m_sent_semaphore.wait();
+  Slab slab = {0, 0};
+  while (m_sent_queue.pop(slab) == false) {
+    thread::Sched().yield();
+  }
+  return slab;
+}
+
+SlabChannel &SlabChannel::release(const Slab &slab) {
+  m_free_queue.push(slab.index);
+  m_free_semaphore.post();
+  return *this;
+}
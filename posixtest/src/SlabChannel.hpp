@@ -0,0 +1,55 @@
+// Copyright 2011-2021 Tyler Gilbert and Stratify Labs, Inc; see LICENSE.md
+
+#ifndef SLABCHANNEL_HPP
+#define SLABCHANNEL_HPP
+
+#include <thread/Semaphore.hpp>
+#include <var/Vector.hpp>
+
+#include "LockFreeQueue.hpp"
+
+// Passes large messages between threads without copying them.
+//
+// The channel owns a pool of fixed-size slabs. The producer acquire()s a free
+// slab, writes the message into it in place and send()s it; the consumer
+// receive()s the slab, reads it in place and release()s it back to the pool.
+// Only the slab handle goes through the queues, so a message is written once
+// and read once no matter its size. acquire() blocks while every slab is in
+// use and receive() blocks until a slab has been sent.
+class SlabChannel {
+public:
+  static constexpr u32 maximum_slab_count = 16;
+
+  struct Slab {
+    u32 index;
+    // bytes of the slab holding the message
+    u32 size;
+  };
+
+  // slab_count is limited to maximum_slab_count
+  SlabChannel(u32 slab_size, u32 slab_count);
+
+  u32 slab_size() const { return m_slab_size; }
+  u32 slab_count() const { return m_slab_count; }
+
+  void *data(const Slab &slab) {
+    return m_memory.data() + slab.index * m_slab_size;
+  }
+
+  Slab acquire();
+  SlabChannel &send(const Slab &slab);
+  Slab receive();
+  SlabChannel &release(const Slab &slab);
+
+private:
+  u32 m_slab_size;
+  u32 m_slab_count;
+  var::Vector<u8> m_memory;
+  // counts the handles in each queue so waiting blocks instead of spinning
+  thread::UnnamedSemaphore m_free_semaphore;
+  thread::UnnamedSemaphore m_sent_semaphore;
+  lock_free::MpmcQueue<u32, maximum_slab_count> m_free_queue;
+  lock_free::MpmcQueue<Slab, maximum_slab_count> m_sent_queue;
+};
+
+#endif // SLABCHANNEL_HPP
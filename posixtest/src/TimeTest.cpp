@@ -1,13 +1,44 @@
+#include <atomic>
+#include <cstring>
+#include <fcntl.h>
+#include <unistd.h>
+
 #include <chrono.hpp>
+#include <fs.hpp>
 #include <test/Case.hpp>
 #include <thread.hpp>
 #include <var.hpp>
 
+#include "CliOption.hpp"
+#include "Histogram.hpp"
+#include "PolicyPriority.hpp"
+#include "ResultArchive.hpp"
 #include "TimeTest.hpp"
 
 int TimeTest::signal_value = 0;
 
-TimeTest::TimeTest() : test::Test("posix::time") {}
+TimeTest::Options::Options(const Cli &cli) {
+  set_cyclic_period_us(parse_u32_option(
+    cli,
+    "cyclicPeriod",
+    "microseconds between wakeups of the cyclic latency thread, less than "
+    "1000000 (default 1000)",
+    cyclic_period_us()));
+  set_cyclic_duration_s(parse_u32_option(
+    cli,
+    "cyclicDuration",
+    "seconds per policy and priority, at most 4000 (default 5)",
+    cyclic_duration_s()));
+  set_cpu_load(
+    cli.get_option("cyclicCpuLoad", "spin a background thread while measuring")
+    == "true");
+  set_io_load(cli.get_option("cyclicIoLoad",
+                             "write to /home in the background while measuring")
+              == "true");
+}
+
+TimeTest::TimeTest(const Options &options)
+  : test::Test("posix::time"), m_options(options) {}
 
 bool TimeTest::execute_class_api_case() {
   TEST_ASSERT_RESULT(execute_class_timeofday_api_case());
@@ -183,3 +214,176 @@ bool TimeTest::execute_class_timer_api_case() {
 
   return case_result();
 }
+
+bool TimeTest::execute_class_performance_case() {
+  // usleep() may reject a second or more
+  TEST_ASSERT(
+    m_options.cyclic_period_us() > 0 && m_options.cyclic_period_us() < 1000000);
+  // the microsecond clock wraps after 71 minutes
+  TEST_ASSERT(
+    m_options.cyclic_duration_s() > 0 && m_options.cyclic_duration_s() <= 4000);
+
+  for_each_policy_priority(
+    [this](const char *name, Sched::Policy policy, int priority) {
+      TEST_EXPECT(
+        execute_class_cyclic_performance_case(name, policy, priority));
+    });
+
+  return case_result();
+}
+
+bool TimeTest::execute_class_cyclic_performance_case(StringView policy_name,
+                                                     Sched::Policy policy,
+                                                     int priority) {
+  const auto case_name = "cyclic" | policy_name | NumberString(priority);
+  test::Case tc(this, case_name);
+
+  // Like cyclictest: a thread sleeps until its next period and records how
+  // late it woke. Deadlines are absolute, kept from the start time, so one
+  // late wakeup does not shift the ones after it.
+  struct Shared {
+    ClockTimer clock;
+    u32 period_us = 0;
+    u32 cycle_count = 0;
+    // wakeup latency, microseconds
+    Histogram latency_histogram;
+    // wakeups later than a whole period, the deadline was missed
+    u32 overrun_count = 0;
+    std::atomic<bool> is_stop{false};
+    // iterations of each load, shows it ran
+    u32 cpu_load_count = 0;
+    u32 io_load_count = 0;
+  };
+
+  Shared shared;
+  shared.period_us = m_options.cyclic_period_us();
+  shared.cycle_count =
+    u32(u64(m_options.cyclic_duration_s()) * 1000000 / shared.period_us);
+  TEST_ASSERT(shared.cycle_count > 0);
+
+  // loads run at the lowest priority of policy other, below the thread
+  // being measured unless it is at that priority itself
+  const auto load_attributes =
+    Thread::Attributes()
+      .set_joinable()
+      .set_sched_policy(Sched::Policy::other)
+      .set_sched_priority(Sched::get_priority_min(Sched::Policy::other));
+
+  Thread cpu_load_thread;
+  if (m_options.is_cpu_load()) {
+    cpu_load_thread = Thread(
+      load_attributes,
+      Thread::Construct().set_argument(&shared).set_function(
+        [](void *args) -> void * {
+          auto *shared = reinterpret_cast<Shared *>(args);
+          volatile u32 work = 0;
+          while (shared->is_stop == false) {
+            for (u32 i = 0; i < 1000; i++) {
+              work = work + i;
+            }
+            shared->cpu_load_count++;
+          }
+          return nullptr;
+        }));
+    TEST_ASSERT(is_success());
+  }
+
+  Thread io_load_thread;
+  const bool is_io_load =
+    m_options.is_io_load() && FileSystem().directory_exists("/home");
+  if (m_options.is_io_load() && is_io_load == false) {
+    printer().info("/home not available -- no io load");
+  }
+  if (is_io_load) {
+    io_load_thread = Thread(
+      load_attributes,
+      Thread::Construct().set_argument(&shared).set_function(
+        [](void *args) -> void * {
+          auto *shared = reinterpret_cast<Shared *>(args);
+          const char *path = "/home/cyclic.tmp";
+          const int fd = open(path, O_RDWR | O_CREAT | O_TRUNC, 0666);
+          if (fd < 0) {
+            return nullptr;
+          }
+          u8 block[512];
+          memset(block, 0xaa, sizeof(block));
+          // rewrite the first 16 KiB over and over
+          while (shared->is_stop == false) {
+            for (u32 i = 0; i < 32 && shared->is_stop == false; i++) {
+              write(fd, block, sizeof(block));
+              shared->io_load_count++;
+            }
+            lseek(fd, 0, SEEK_SET);
+          }
+          close(fd);
+          unlink(path);
+          return nullptr;
+        }));
+    TEST_ASSERT(is_success());
+  }
+
+  shared.clock.start();
+  auto cyclic_thread = Thread(
+    Thread::Attributes()
+      .set_joinable()
+      .set_sched_policy(policy)
+      .set_sched_priority(priority),
+    Thread::Construct().set_argument(&shared).set_function(
+      [](void *args) -> void * {
+        auto *shared = reinterpret_cast<Shared *>(args);
+        u32 deadline = shared->clock.microseconds();
+        for (u32 i = 0; i < shared->cycle_count; i++) {
+          deadline += shared->period_us;
+          const u32 now = shared->clock.microseconds();
+          if (s32(deadline - now) > 0) {
+            usleep(deadline - now);
+          }
+          const u32 latency = shared->clock.microseconds() - deadline;
+          shared->latency_histogram.add(latency);
+          if (latency >= shared->period_us) {
+            shared->overrun_count++;
+          }
+        }
+        return nullptr;
+      }));
+  TEST_ASSERT(is_success());
+  TEST_EXPECT(cyclic_thread.join().is_success());
+
+  shared.is_stop = true;
+  if (m_options.is_cpu_load()) {
+    TEST_EXPECT(cpu_load_thread.join().is_success());
+  }
+  if (is_io_load) {
+    TEST_EXPECT(io_load_thread.join().is_success());
+  }
+  shared.clock.stop();
+
+  const Histogram &histogram = shared.latency_histogram;
+  TEST_EXPECT(histogram.count() == shared.cycle_count);
+
+  printer()
+    .key("period", NumberString(shared.period_us, "%d us"))
+    .key("cycles", NumberString(shared.cycle_count))
+    .key_bool("cpuLoad", m_options.is_cpu_load())
+    .key_bool("ioLoad", is_io_load)
+    .key("cpuLoadIterations", NumberString(shared.cpu_load_count))
+    .key("ioLoadBlocks", NumberString(shared.io_load_count))
+    .key("min", NumberString(histogram.minimum(), "%d us"))
+    .key("avg", NumberString(histogram.mean(), "%d us"))
+    .key("max", NumberString(histogram.maximum(), "%d us"))
+    .key("p99", NumberString(histogram.percentile(99.0f), "%d us"))
+    .key("p99.99", NumberString(histogram.percentile(99.99f), "%d us"))
+    .key("overruns", NumberString(shared.overrun_count));
+  histogram.print(printer(), "wakeupLatency", "us");
+
+  const GeneralString archive_prefix = "posixtest." | StringView(case_name);
+  ResultArchive::record(archive_prefix | ".max", histogram.maximum(),
+                        ResultArchive::IsHigherBetter::no);
+  ResultArchive::record(archive_prefix | ".p99.99",
+                        histogram.percentile(99.99f),
+                        ResultArchive::IsHigherBetter::no);
+  ResultArchive::record(archive_prefix | ".overruns", shared.overrun_count,
+                        ResultArchive::IsHigherBetter::no);
+
+  return case_result();
+}
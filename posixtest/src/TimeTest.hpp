@@ -1,14 +1,30 @@
 #ifndef TIMETEST_HPP
 #define TIMETEST_HPP
 
+#include <sys/Cli.hpp>
 #include <test/Test.hpp>
+#include <thread/Sched.hpp>
 
 class TimeTest : public test::Test
 {
 public:
-  TimeTest();
+  class Options {
+  public:
+    Options() = default;
+    explicit Options(const sys::Cli &cli);
+
+    // the cyclic thread wakes every period for the duration
+    API_AF(Options, u32, cyclic_period_us, 1000);
+    API_AF(Options, u32, cyclic_duration_s, 5);
+    // background load while measuring
+    API_AB(Options, cpu_load, false);
+    API_AB(Options, io_load, false);
+  };
+
+  TimeTest(const Options &options = Options());
 
   bool execute_class_api_case();
+  bool execute_class_performance_case();
 
 private:
 
@@ -16,6 +32,11 @@ private:
 
   bool execute_class_timeofday_api_case();
   bool execute_class_timer_api_case();
+  bool execute_class_cyclic_performance_case(var::StringView policy_name,
+                                             thread::Sched::Policy policy,
+                                             int priority);
+
+  Options m_options;
 
 };
 
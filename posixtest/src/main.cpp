@@ -7,6 +7,9 @@
 
 #include "MqTest.hpp"
 #include "PThreadTest.hpp"
+#include "Repeat.hpp"
+#include "ResultArchive.hpp"
+#include "RwLockTest.hpp"
 #include "SchedTest.hpp"
 #include "SignalTest.hpp"
 #include "TimeTest.hpp"
@@ -33,7 +36,8 @@ enum {
   signal_test = 1 << 16,
   launch_test = 1 << 17,
   unistd_test = 1 << 18,
-  time_test = 1 << 19
+  time_test = 1 << 19,
+  rwlock_test = 1 << 20
 };
 
 static Test::ExecuteFlags decode_cli(const Cli &cli);
@@ -67,29 +71,43 @@ int main(int argc, char *argv[]) {
                                         .set_version(SL_CONFIG_VERSION_STRING));
 
     Test::printer().set_verbose_level(cli.get_option("verbose"));
+    ResultArchive::Scope archive_scope(
+      cli,
+      "posixtest",
+      SL_CONFIG_VERSION_STRING,
+      SOS_GIT_HASH);
+    const Repeat repeat(cli);
 
     if (u32(o_execute_flags) & sched_test) {
-      SchedTest().execute(o_execute_flags);
+      repeat.execute([&] { return SchedTest(); }, o_execute_flags);
     }
 
     if (u32(o_execute_flags) & pthread_test) {
-      PThreadTest().execute(o_execute_flags);
+      const PThreadTest::Options options(cli);
+      repeat.execute([&] { return PThreadTest(options); }, o_execute_flags);
+    }
+
+    if (u32(o_execute_flags) & rwlock_test) {
+      const RwLockTest::Options options(cli);
+      repeat.execute([&] { return RwLockTest(options); }, o_execute_flags);
     }
 
     if (u32(o_execute_flags) & mq_test) {
-      MqTest().execute(o_execute_flags);
+      const MqTest::Options options(cli);
+      repeat.execute([&] { return MqTest(options); }, o_execute_flags);
     }
 
     if (u32(o_execute_flags) & unistd_test) {
-      UnistdTest(argv[0]).execute(o_execute_flags);
+      repeat.execute([&] { return UnistdTest(argv[0]); }, o_execute_flags);
     }
 
     if (u32(o_execute_flags) & signal_test) {
-      SignalTest().execute(o_execute_flags);
+      repeat.execute([&] { return SignalTest(); }, o_execute_flags);
     }
 
     if (u32(o_execute_flags) & time_test) {
-      TimeTest().execute(o_execute_flags);
+      const TimeTest::Options options(cli);
+      repeat.execute([&] { return TimeTest(options); }, o_execute_flags);
     }
   }
   return 0;
@@ -107,6 +125,7 @@ Test::ExecuteFlags decode_cli(const Cli &cli) {
   o_flags |= Test::parse_test(cli, "sched", sched_test);
   o_flags |= Test::parse_test(cli, "unistd", unistd_test);
   o_flags |= Test::parse_test(cli, "pthread", pthread_test);
+  o_flags |= Test::parse_test(cli, "rwlock", rwlock_test);
   o_flags |= Test::parse_test(cli, "directory", directory_test);
   o_flags |= Test::parse_test(cli, "file", file_test);
   o_flags |= Test::parse_test(cli, "access", access_test);